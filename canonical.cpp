@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <cstdbool>
 #include "index_ptm.h"
+#include "canonical.hpp"
 
 #define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
 #define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
@@ -10,6 +11,39 @@
 #define MAXV 14
 #define MAXE 36
 
+int graph_degree(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree)
+{
+	memset(degree, 0, sizeof(int8_t) * num_nodes);
+
+	for (int i = 0;i<num_facets;i++)
+	{
+		int a = facets[i][0];
+		int b = facets[i][1];
+		int c = facets[i][2];
+
+		degree[a]++;
+		degree[b]++;
+		degree[c]++;
+	}
+
+	int8_t max_degree = 0;
+	for (int i = 0;i<num_nodes;i++)
+		max_degree = MAX(max_degree, degree[i]);
+
+	return max_degree;
+}
+
+//Histogram of the node degrees, 4 bits per degree.  This identifies the sorted degree sequence of a graph.
+//Degrees must not exceed 8 (which the max_degree checks guarantee), and counts must be less than 16.
+uint64_t degree_sequence_key(int num_nodes, int8_t* degree)
+{
+	uint64_t key = 0;
+	for (int i = 0;i<num_nodes;i++)
+		key += (uint64_t)1 << (4 * degree[i]);
+
+	return key;
+}
+
 static bool build_facet_map(int num_facets, int8_t facets[][3], int8_t common[MAXV][MAXV])
 {
 	memset(common, -1, sizeof(int8_t) * MAXV * MAXV);
@@ -34,12 +68,26 @@ static bool build_facet_map(int num_facets, int8_t facets[][3], int8_t common[MA
 	return true;
 }
 
-static bool weinberg(int num_nodes, int num_edges, int8_t common[MAXV][MAXV], int8_t* best_code, int8_t* canonical_labelling, int prev, int cur)
+#define MAX_GENERATORS 8
+
+typedef struct
 {
-	bool m[MAXV][MAXV];
-	memset(m, 0, sizeof(bool) * MAXV * MAXV);
+	int num_nodes;
+	int num_edges;
+	int8_t (*common)[MAXV];
+	int8_t* best_code;
+	int8_t* canonical_labelling;
+
+	uint16_t tried[MAXV];			//bit b of tried[a] is set once start edge (a, b), or an automorphic image of it, has been searched
+	int num_generators;
+	int8_t generators[MAX_GENERATORS][MAXV];
+} searchstate_t;
+
+//returns 1 if the code starting at edge (prev, cur) is better than best_code, 0 if equal and -1 if worse
+static int weinberg(int num_edges, int8_t common[MAXV][MAXV], int8_t* best_code, int8_t* index, int prev, int cur)
+{
+	uint16_t m[MAXV] = {0};			//bit j of m[i] is set once edge (i, j) has been traversed
 
-	int8_t index[MAXV];
 	memset(index, -1, sizeof(int8_t) * MAXV);
 	index[prev] = 0;
 	int n = 1;
@@ -48,21 +96,21 @@ static bool weinberg(int num_nodes, int num_edges, int8_t common[MAXV][MAXV], in
 	int next = -1;
 	for (int it=1;it<2*num_edges;it++)
 	{
-		m[prev][cur] = true;
+		m[prev] |= 1 << cur;
 
 		if (index[cur] == -1)
 		{
 			next = common[prev][cur];
 			index[cur] = n++;
 		}
-		else if (m[cur][prev] == false)
+		else if (!(m[cur] & (1 << prev)))
 		{
 			next = prev;
 		}
 		else
 		{
 			next = common[prev][cur];
-			while (m[cur][next] == true)
+			while (m[cur] & (1 << next))
 				next = common[next][cur];
 		}
 
@@ -70,7 +118,7 @@ static bool weinberg(int num_nodes, int num_edges, int8_t common[MAXV][MAXV], in
 		cur = next;
 
 		if (!winning && index[cur] > best_code[it])
-			return false;
+			return -1;
 
 		if (winning || index[cur] < best_code[it])
 		{
@@ -79,13 +127,62 @@ static bool weinberg(int num_nodes, int num_edges, int8_t common[MAXV][MAXV], in
 		}
 	}
 
-	if (winning)
+	return winning ? 1 : 0;
+}
+
+//marks the images of all tried start edges under the known automorphisms
+static void close_tried_edges(searchstate_t* s)
+{
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (int g = 0;g<s->num_generators;g++)
+		{
+			int8_t* sigma = s->generators[g];
+			for (int a = 0;a<s->num_nodes;a++)
+			{
+				uint16_t image = 0;
+				for (uint32_t bits = s->tried[a];bits != 0;bits &= bits - 1)
+					image |= 1 << sigma[__builtin_ctz(bits)];
+
+				int ga = sigma[a];
+				if ((s->tried[ga] | image) != s->tried[ga])
+				{
+					s->tried[ga] |= image;
+					changed = true;
+				}
+			}
+		}
+	}
+}
+
+static void search_start_edge(searchstate_t* s, int a, int b)
+{
+	if (s->tried[a] & (1 << b))
+		return;
+
+	s->tried[a] |= 1 << b;
+
+	int8_t index[MAXV];
+	int ret = weinberg(s->num_edges, s->common, s->best_code, index, a, b);
+	if (ret == 1)
 	{
-		memcpy(canonical_labelling, index, sizeof(int8_t) * num_nodes);
-		return true;
+		memcpy(s->canonical_labelling, index, sizeof(int8_t) * s->num_nodes);
 	}
+	else if (ret == 0 && s->num_generators < MAX_GENERATORS)
+	{
+		//equal codes: mapping each node to the node with the same label in the best labelling is an automorphism
+		int8_t inverse[MAXV];
+		for (int i = 0;i<s->num_nodes;i++)
+			inverse[s->canonical_labelling[i]] = i;
+
+		int8_t* sigma = s->generators[s->num_generators++];
+		for (int i = 0;i<s->num_nodes;i++)
+			sigma[i] = inverse[index[i]];
 
-	return false;
+		close_tried_edges(s);
+	}
 }
 
 int canonical_form(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree, int8_t* canonical_labelling, uint64_t* p_hash)
@@ -99,6 +196,15 @@ int canonical_form(int num_facets, int8_t facets[][3], int num_nodes, int8_t* de
 	memset(best_code, 126, sizeof(int8_t) * 2 * num_edges);
 	best_code[0] = 0;
 
+	searchstate_t s;
+	s.num_nodes = num_nodes;
+	s.num_edges = num_edges;
+	s.common = common;
+	s.best_code = best_code;
+	s.canonical_labelling = canonical_labelling;
+	s.num_generators = 0;
+	memset(s.tried, 0, sizeof(s.tried));
+
 	bool equal = true;
 	for (int i = 1;i<num_nodes;i++)
 		if (degree[i] != degree[0])
@@ -106,7 +212,7 @@ int canonical_form(int num_facets, int8_t facets[][3], int num_nodes, int8_t* de
 
 	if (equal)
 	{
-		weinberg(num_nodes, num_edges, common, best_code, canonical_labelling, facets[0][0], facets[0][1]);
+		search_start_edge(&s, facets[0][0], facets[0][1]);
 	}
 	else
 	{
@@ -137,13 +243,13 @@ int canonical_form(int num_facets, int8_t facets[][3], int num_nodes, int8_t* de
 			int dc = degree[c];
 
 			if (best_degree == (((uint32_t)da << 16) | ((uint32_t)db << 8) | ((uint32_t)dc << 0)))
-				weinberg(num_nodes, num_edges, common, best_code, canonical_labelling, a, b);
+				search_start_edge(&s, a, b);
 
 			if (best_degree == (((uint32_t)da << 0) | ((uint32_t)db << 16) | ((uint32_t)dc << 8)))
-				weinberg(num_nodes, num_edges, common, best_code, canonical_labelling, b, c);
+				search_start_edge(&s, b, c);
 
 			if (best_degree == (((uint32_t)da << 8) | ((uint32_t)db << 0) | ((uint32_t)dc << 16)))
-				weinberg(num_nodes, num_edges, common, best_code, canonical_labelling, c, a);
+				search_start_edge(&s, c, a);
 		}
 	}
 
@@ -3,6 +3,8 @@
 
 #include <cstdint>
 
+int graph_degree(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree);
+uint64_t degree_sequence_key(int num_nodes, int8_t* degree);
 int canonical_form(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree, int8_t* canonical_labelling, uint64_t* p_hash);
 
 #endif
@@ -10,9 +10,6 @@
 #define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
 #define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
 
-#define VISIBLE 1
-#define INVISIBLE 2
-#define BOTH 3
 #define TOLERANCE 1E-8
 
 static double norm_squared(double* p)
@@ -215,9 +212,59 @@ void add_facet(const double (*points)[3], int a, int b, int c, int8_t* facet, do
 	}
 }
 
-static int initialize_convex_hull(int num_points, const double (*points)[3], int8_t facets[][3], double plane_normal[][3], bool* processed, int* initial_vertices, double* barycentre)
+//adds a facet to the end of the hull
+static void append_facet(const double (*points)[3], int a, int b, int c, convexhull_t* ch)
 {
-	memset(processed, 0, 15 * sizeof(bool));
+	int j = ch->num_facets++;
+	double plane_normal[3];
+	add_facet(points, a, b, c, ch->facets[j], plane_normal, ch->barycentre);
+
+	ch->normal_x[j] = plane_normal[0];
+	ch->normal_y[j] = plane_normal[1];
+	ch->normal_z[j] = plane_normal[2];
+
+	const double* p = points[ch->facets[j][0]];
+	ch->plane_x[j] = p[0];
+	ch->plane_y[j] = p[1];
+	ch->plane_z[j] = p[2];
+}
+
+static void move_facet(convexhull_t* ch, int src, int dst)
+{
+	memcpy(ch->facets[dst], ch->facets[src], 3 * sizeof(int8_t));
+	ch->normal_x[dst] = ch->normal_x[src];
+	ch->normal_y[dst] = ch->normal_y[src];
+	ch->normal_z[dst] = ch->normal_z[src];
+	ch->plane_x[dst] = ch->plane_x[src];
+	ch->plane_y[dst] = ch->plane_y[src];
+	ch->plane_z[dst] = ch->plane_z[src];
+}
+
+//bit j is set if point w is in front of facet j
+static uint32_t visible_facets(const convexhull_t* ch, const double* w)
+{
+	double wx = w[0], wy = w[1], wz = w[2];
+	double distance[MAXF];
+
+	//the same arithmetic as point_plane_distance, over all facets at once
+	int num_facets = ch->num_facets;
+	for (int j = 0;j<num_facets;j++)
+		distance[j] =	  ch->normal_x[j] * (ch->plane_x[j] - wx)
+				+ ch->normal_y[j] * (ch->plane_y[j] - wy)
+				+ ch->normal_z[j] * (ch->plane_z[j] - wz);
+
+	uint32_t mask = 0;
+	for (int j = 0;j<num_facets;j++)
+		mask |= (uint32_t)(distance[j] > TOLERANCE) << j;
+	return mask;
+}
+
+static int initialize_convex_hull(int num_points, const double (*points)[3], convexhull_t* ch)
+{
+	int* initial_vertices = ch->initial_vertices;
+	double* barycentre = ch->barycentre;
+
+	memset(ch->processed, 0, 15 * sizeof(bool));
 	memset(barycentre, 0, 3 * sizeof(double));
 	int ret = initial_simplex(num_points, points, initial_vertices);
 	if (ret != 0)
@@ -226,7 +273,7 @@ static int initialize_convex_hull(int num_points, const double (*points)[3], int
 	for (int i = 0;i<4;i++)
 	{
 		int a = initial_vertices[i];
-		processed[a] = true;
+		ch->processed[a] = true;
 
 		barycentre[0] += points[a][0];
 		barycentre[1] += points[a][1];
@@ -236,10 +283,11 @@ static int initialize_convex_hull(int num_points, const double (*points)[3], int
 	barycentre[1] /= 4;
 	barycentre[2] /= 4;
 
-	add_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[2], facets[0], plane_normal[0], barycentre);
-	add_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[3], facets[1], plane_normal[1], barycentre);
-	add_facet(points, initial_vertices[0], initial_vertices[2], initial_vertices[3], facets[2], plane_normal[2], barycentre);
-	add_facet(points, initial_vertices[1], initial_vertices[2], initial_vertices[3], facets[3], plane_normal[3], barycentre);
+	ch->num_facets = 0;
+	append_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[2], ch);
+	append_facet(points, initial_vertices[0], initial_vertices[1], initial_vertices[3], ch);
+	append_facet(points, initial_vertices[0], initial_vertices[2], initial_vertices[3], ch);
+	append_facet(points, initial_vertices[1], initial_vertices[2], initial_vertices[3], ch);
 	return 0;
 }
 
@@ -252,11 +300,10 @@ int get_convex_hull(int num_points, const double (*points)[3], int num_expected_
 	ch->num_prev = num_points;
 	if (!ch->ok || 0)
 	{
-		ret = initialize_convex_hull(num_points, points, ch->facets, ch->plane_normal, ch->processed, ch->initial_vertices, ch->barycentre);
+		ret = initialize_convex_hull(num_points, points, ch);
 		if (ret != 0)
 			return ret;
 
-		ch->num_facets = 4;
 		num_prev = 0;
 	}
 
@@ -266,71 +313,62 @@ int get_convex_hull(int num_points, const double (*points)[3], int num_expected_
 			continue;
 		ch->processed[i] = true;
 
+		uint32_t visible = visible_facets(ch, points[i]);
+		if (visible == 0)
+			continue;	//point is inside the hull
+
+		//Edges are flagged by the visibility of the facets sharing them, and an edge becomes a new facet with the
+		//inserted point when it is flagged both ways.  Visible facets are removed by moving the last facet into
+		//their place, so the facets are visited and the edges oriented in the same order as the scalar loop.
+		//Bit b of edges[0][a] (edges[1][a]) is set if edge (a, b) belongs to a visible (invisible) facet.
 		int num_to_add = 0;
-		int8_t to_add[MAXF][3];
-		int8_t edge_visible[15][15];
-		memset(edge_visible, 0, sizeof(int8_t) * 15 * 15);
+		int8_t to_add[3 * MAXF][3];
+		uint16_t edges[2][15] = {{0}};
+
+		int8_t original[MAXF];	//position of each facet when the visibility mask was computed
+		for (int j = 0;j<ch->num_facets;j++)
+			original[j] = j;
+
 		for (int j = 0;j<ch->num_facets;j++)
 		{
 			int a = ch->facets[j][0];
 			int b = ch->facets[j][1];
 			int c = ch->facets[j][2];
 
-			int u = 0, v = 0, w = 0;
+			//an edge is flagged both ways once it has been flagged with the opposite visibility
+			bool vis = (visible >> original[j]) & 1;
+			uint16_t* rows = edges[vis ? 0 : 1];
+			const uint16_t* opposite = edges[vis ? 1 : 0];
+			int u = (opposite[a] >> b) & 1;
+			int v = (opposite[b] >> c) & 1;
+			int w = (opposite[c] >> a) & 1;
+			rows[a] |= (1 << b) | (1 << c);
+			rows[b] |= (1 << c) | (1 << a);
+			rows[c] |= (1 << a) | (1 << b);
 
-			double distance = point_plane_distance(points[i], points[a], ch->plane_normal[j]);
-			bool vis = distance > TOLERANCE;
 			if (vis)
 			{
-				u = edge_visible[a][b] |= VISIBLE;
-				edge_visible[b][a] |= VISIBLE;
-
-				v = edge_visible[b][c] |= VISIBLE;
-				edge_visible[c][b] |= VISIBLE;
-
-				w = edge_visible[c][a] |= VISIBLE;
-				edge_visible[a][c] |= VISIBLE;
-
-				memcpy(ch->facets[j], ch->facets[ch->num_facets-1], 3 * sizeof(int8_t));
-				memcpy(ch->plane_normal[j], ch->plane_normal[ch->num_facets-1], 3 * sizeof(double));
-				ch->num_facets--;
+				int last = --ch->num_facets;
+				if (last != j)
+					move_facet(ch, last, j);
+				original[j] = original[last];
 				j--;
 			}
-			else
-			{
-				u = edge_visible[a][b] |= INVISIBLE;
-				edge_visible[b][a] |= INVISIBLE;
 
-				v = edge_visible[b][c] |= INVISIBLE;
-				edge_visible[c][b] |= INVISIBLE;
+			to_add[num_to_add][0] = i;
+			to_add[num_to_add][1] = a;
+			to_add[num_to_add][2] = b;
+			num_to_add += u;
 
-				w = edge_visible[c][a] |= INVISIBLE;
-				edge_visible[a][c] |= INVISIBLE;
-			}
+			to_add[num_to_add][0] = i;
+			to_add[num_to_add][1] = b;
+			to_add[num_to_add][2] = c;
+			num_to_add += v;
 
-			if (u == BOTH)
-			{
-				to_add[num_to_add][0] = i;
-				to_add[num_to_add][1] = a;
-				to_add[num_to_add][2] = b;
-				num_to_add++;
-			}
-
-			if (v == BOTH)
-			{
-				to_add[num_to_add][0] = i;
-				to_add[num_to_add][1] = b;
-				to_add[num_to_add][2] = c;
-				num_to_add++;
-			}
-
-			if (w == BOTH)
-			{
-				to_add[num_to_add][0] = i;
-				to_add[num_to_add][1] = c;
-				to_add[num_to_add][2] = a;
-				num_to_add++;
-			}
+			to_add[num_to_add][0] = i;
+			to_add[num_to_add][1] = c;
+			to_add[num_to_add][2] = a;
+			num_to_add += w;
 		}
 
 		for (int j = 0;j<num_to_add;j++)
@@ -338,7 +376,7 @@ int get_convex_hull(int num_points, const double (*points)[3], int num_expected_
 			if (ch->num_facets >= MAXF)
 				return -4;
 
-			add_facet(points, to_add[j][0], to_add[j][1], to_add[j][2], ch->facets[ch->num_facets], ch->plane_normal[ch->num_facets], ch->barycentre); ch->num_facets++;
+			append_facet(points, to_add[j][0], to_add[j][1], to_add[j][2], ch);
 		}
 	}
 
@@ -9,7 +9,11 @@
 typedef struct
 {
 	int8_t facets[MAXF][3];
-	double plane_normal[MAXF][3];
+
+	//facet planes in structure-of-arrays form, so that a point can be tested against every facet at once
+	double normal_x[MAXF], normal_y[MAXF], normal_z[MAXF];
+	double plane_x[MAXF], plane_y[MAXF], plane_z[MAXF];	//first vertex of each facet
+
 	bool processed[15];
 	int initial_vertices[4];
 	double barycentre[3];
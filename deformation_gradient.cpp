@@ -1,5 +1,8 @@
 #include <cstdint>
+#include <cstring>
 #include "deformation_gradient.hpp"
+#include "index_ptm.h"
+#include "point_dispatch.hpp"
 
 
 //sc
@@ -90,37 +93,75 @@ const double penrose_bcc[15][3] = {
 					{2*k_bcc, 0, -0},
 				};
 
-void calculate_deformation_gradient(int num_points, const double (*ideal_points)[3], int8_t* mapping, double (*normalized)[3], const double (*penrose)[3], double* F, double* res)
+static deformationtable_t make_deformation_table(int num_points, const double (*ideal_points)[3], const double (*penrose)[3])
 {
-	for (int i = 0;i<3;i++)
+	deformationtable_t t;
+	memset(&t, 0, sizeof(deformationtable_t));
+	t.num_points = num_points;
+	for (int k = 0;k<num_points;k++)
 	{
 		for (int j = 0;j<3;j++)
 		{
-			double acc = 0.0;
-			for (int k = 0;k<num_points;k++)
-				acc += penrose[k][j] * normalized[mapping[k]][i];
-
-			F[i*3 + j] = acc;
+			t.coefficients[k][j] = penrose[k][j];
+			t.coefficients[k][3 + j] = ideal_points[k][j];
 		}
+
+		for (int i = 0;i<3;i++)
+			for (int j = 0;j<3;j++)
+				t.gram[i][j] += ideal_points[k][i] * ideal_points[k][j];
 	}
 
-	res[0] = 0;
-	res[1] = 0;
-	res[2] = 0;
+	return t;
+}
 
-	for (int k = 0;k<num_points;k++)
+const deformationtable_t deformation_sc  = make_deformation_table( 7, ptm_template_sc,  penrose_sc );
+const deformationtable_t deformation_fcc = make_deformation_table(13, ptm_template_fcc, penrose_fcc);
+const deformationtable_t deformation_hcp = make_deformation_table(13, ptm_template_hcp, penrose_hcp);
+const deformationtable_t deformation_ico = make_deformation_table(13, ptm_template_ico, penrose_ico);
+const deformationtable_t deformation_bcc = make_deformation_table(15, ptm_template_bcc, penrose_bcc);
+
+//F and the residual in one pass over the mapped points.  With C = sum x p^T (p the ideal points) and G = sum p p^T, the residual
+//of each component is sum (F_i . p - x_i)^2 = sum x_i^2 - 2 F_i . C_i + F_i G F_i^T.
+template <int N>
+static void deformation_gradient_kernel(const deformationtable_t* table, int8_t* mapping, double (*normalized)[3], double* F, double* res)
+{
+	const int n = N > 0 ? N : table->num_points;
+
+	double acc[3][3] = {{0}}, cross[3][3] = {{0}}, sq[3] = {0, 0, 0};
+	for (int k = 0;k<n;k++)
 	{
+		const double* c = table->coefficients[k];
+		const double* x = normalized[mapping[k]];
 		for (int i = 0;i<3;i++)
 		{
-			double acc = 0.0;
+			sq[i] += x[i] * x[i];
 			for (int j = 0;j<3;j++)
 			{
-				acc += F[i*3 + j] * ideal_points[k][j];
+				acc[i][j] += c[j] * x[i];
+				cross[i][j] += c[3 + j] * x[i];
 			}
+		}
+	}
 
-			double delta = acc - normalized[mapping[k]][i];
-			res[i] += delta * delta;
+	for (int i = 0;i<3;i++)
+	{
+		double r = sq[i];
+		for (int j = 0;j<3;j++)
+		{
+			F[i*3 + j] = acc[i][j];
+
+			double g = 0.0;
+			for (int l = 0;l<3;l++)
+				g += table->gram[j][l] * acc[i][l];
+			r += acc[i][j] * (g - 2 * cross[i][j]);
 		}
+
+		res[i] = r > 0 ? r : 0;
 	}
 }
 
+void calculate_deformation_gradient(const deformationtable_t* table, int8_t* mapping, double (*normalized)[3], double* F, double* res)
+{
+	DISPATCH_NUM_POINTS(table->num_points, deformation_gradient_kernel, table, mapping, normalized, F, res);
+}
+
@@ -3,7 +3,21 @@
 
 #include <cstdint>
 
-void calculate_deformation_gradient(int num_points, const double (*ideal_points)[3], int8_t* mapping, double (*normalized)[3], const double (*penrose)[3], double* F, double* res);
+//per-structure constants of the deformation gradient fit
+typedef struct
+{
+	int num_points;
+	alignas(32) double coefficients[15][6];	//penrose inverse (first three) and ideal point (last three) of each template point
+	double gram[3][3];			//sum of p p^T over the ideal points
+} deformationtable_t;
+
+void calculate_deformation_gradient(const deformationtable_t* table, int8_t* mapping, double (*normalized)[3], double* F, double* res);
+
+extern const deformationtable_t deformation_sc;
+extern const deformationtable_t deformation_fcc;
+extern const deformationtable_t deformation_hcp;
+extern const deformationtable_t deformation_ico;
+extern const deformationtable_t deformation_bcc;
 
 extern const double penrose_sc[7][3];
 extern const double penrose_fcc[13][3];
@@ -0,0 +1,114 @@
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include "index_ptm.h"
+#include "qcprot/quat.hpp"
+#include "disorientation.h"
+#include "parallel_ranges.hpp"
+
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+//atoms per gather block in ptm_neighbour_disorientations
+#define BLOCK_ATOMS 256
+
+typedef void (*disorientation_kernel_t)(int num, const double* q0, const double* q1, double* angles);
+
+static disorientation_kernel_t symmetry_kernel(int32_t type)
+{
+	if (type == PTM_MATCH_FCC || type == PTM_MATCH_BCC || type == PTM_MATCH_SC)
+		return quat_disorientations_cubic;
+	else if (type == PTM_MATCH_HCP)
+		return quat_disorientations_hcp;
+	else if (type == PTM_MATCH_ICO)
+		return quat_disorientations_icosahedral;
+	return NULL;
+}
+
+int ptm_disorientations(int32_t type, int num_pairs, const double* q0, const double* q1, int num_threads, double* angles)
+{
+	disorientation_kernel_t kernel = symmetry_kernel(type);
+	if (kernel == NULL || num_pairs < 0 || (num_pairs > 0 && (q0 == NULL || q1 == NULL || angles == NULL)))
+		return PTM_DISORIENTATION_INVALID_ARGUMENT;
+
+	num_threads = num_worker_threads(num_threads, num_pairs, 4096);
+	parallel_ranges(num_threads, num_pairs, [=](int64_t begin, int64_t end) {
+		kernel(end - begin, &q0[4 * begin], &q1[4 * begin], &angles[begin]);
+	});
+	return PTM_NO_ERROR;
+}
+
+//Gathers the pairs of a block of atoms by symmetry group, so that each group is processed with one contiguous kernel call.
+typedef struct
+{
+	std::vector<double> q0, q1, angles;
+	std::vector<int64_t> slot;		//output index of each gathered pair
+} pairgroup_t;
+
+static void neighbour_block(	int64_t begin, int64_t end, int num_atoms, const int32_t* types, const double* q,
+				int num_nbrs, int nbr_stride, const int32_t* nbrs, pairgroup_t* groups, double* angles)
+{
+	const disorientation_kernel_t kernels[3] = {quat_disorientations_cubic, quat_disorientations_hcp, quat_disorientations_icosahedral};
+
+	for (int g=0;g<3;g++)
+	{
+		groups[g].q0.clear();
+		groups[g].q1.clear();
+		groups[g].slot.clear();
+	}
+
+	for (int64_t i=begin;i<end;i++)
+	{
+		int32_t type = types[i];
+		disorientation_kernel_t kernel = symmetry_kernel(type);
+		for (int k=0;k<num_nbrs;k++)
+		{
+			int64_t slot = i * num_nbrs + k;
+			int32_t j = nbrs[i * nbr_stride + k];
+			if (kernel == NULL || j < 0 || j >= num_atoms || types[j] != type)
+			{
+				angles[slot] = NAN;
+				continue;
+			}
+
+			int g = kernel == quat_disorientations_cubic ? 0 : (kernel == quat_disorientations_hcp ? 1 : 2);
+			groups[g].q0.insert(groups[g].q0.end(), &q[4 * i], &q[4 * i + 4]);
+			groups[g].q1.insert(groups[g].q1.end(), &q[4 * (int64_t)j], &q[4 * (int64_t)j + 4]);
+			groups[g].slot.push_back(slot);
+		}
+	}
+
+	for (int g=0;g<3;g++)
+	{
+		int n = groups[g].slot.size();
+		if (n == 0)
+			continue;
+
+		groups[g].angles.resize(n);
+		kernels[g](n, &groups[g].q0[0], &groups[g].q1[0], &groups[g].angles[0]);
+		for (int k=0;k<n;k++)
+			angles[groups[g].slot[k]] = groups[g].angles[k];
+	}
+}
+
+int ptm_neighbour_disorientations(	int num_atoms, const int32_t* types, const double* q,
+					int num_nbrs, int nbr_stride, const int32_t* nbrs, int num_threads,
+					double* angles)
+{
+	if (num_atoms < 0 || num_nbrs < 0 || nbr_stride < num_nbrs)
+		return PTM_DISORIENTATION_INVALID_ARGUMENT;
+
+	if (num_atoms > 0 && (types == NULL || q == NULL || (num_nbrs > 0 && (nbrs == NULL || angles == NULL))))
+		return PTM_DISORIENTATION_INVALID_ARGUMENT;
+
+	int64_t num_blocks = (num_atoms + BLOCK_ATOMS - 1) / BLOCK_ATOMS;
+	num_threads = num_worker_threads(num_threads, num_blocks, 4);
+	parallel_ranges(num_threads, num_blocks, [=](int64_t begin, int64_t end) {
+		pairgroup_t groups[3];
+		for (int64_t b=begin;b<end;b++)
+			neighbour_block(b * BLOCK_ATOMS, MIN((b + 1) * BLOCK_ATOMS, (int64_t)num_atoms), num_atoms, types, q,
+					num_nbrs, nbr_stride, nbrs, groups, angles);
+	});
+	return PTM_NO_ERROR;
+}
+
@@ -0,0 +1,34 @@
+#ifndef DISORIENTATION_H
+#define DISORIENTATION_H
+
+#include <stdint.h>
+
+//------------------------------------
+//    definitions
+//------------------------------------
+#define PTM_DISORIENTATION_INVALID_ARGUMENT	-1
+
+//------------------------------------
+//    disorientation angles
+//------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Disorientation angles (radians) of num_pairs pairs of quaternions (4 doubles each) of one structure type (PTM_MATCH_*).
+//num_threads = 0 uses all hardware threads.
+int ptm_disorientations(int32_t type, int num_pairs, const double* q0, const double* q1, int num_threads,	//inputs
+			double* angles);									//output
+
+//Disorientation angles between each atom and its first num_nbrs neighbours in nbrs (num_atoms x nbr_stride atom indices).
+//angles is num_atoms x num_nbrs.  Pairs of different or unmatched structure types, and negative neighbour indices, give NaN.
+int ptm_neighbour_disorientations(	int num_atoms, const int32_t* types, const double* q,
+					int num_nbrs, int nbr_stride, const int32_t* nbrs, int num_threads,	//inputs
+					double* angles);							//output
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,151 @@
+//Generates graph_tables.cpp from the reference graphs in graph_data.cpp: run "make graph_tables" after changing them.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include "convex_hull_incremental.hpp"
+#include "canonical.hpp"
+#include "graph_data.hpp"
+#include "index_ptm.h"
+
+
+typedef struct
+{
+	const char* name;
+	int num_nbrs;
+	int num_facets;
+	int num_graphs;
+	const graph_t* graphs;
+	const double (*points)[3];
+} source_t;
+
+static void make_facets_clockwise(int num_facets, int8_t (*facets)[3], const double (*points)[3])
+{
+	double plane_normal[3];
+	double origin[3] = {0, 0, 0};
+
+	for (int i = 0;i<num_facets;i++)
+		add_facet(points, facets[i][0], facets[i][1], facets[i][2], facets[i], plane_normal, origin);
+}
+
+static int write_table(FILE* fout, source_t* s)
+{
+	std::vector<graph_t> graphs(s->graphs, s->graphs + s->num_graphs);
+	std::vector< std::pair<uint64_t, int> > hash_index;
+	std::vector<uint64_t> degree_sequences;
+
+	for (int i = 0;i<s->num_graphs;i++)
+	{
+		graph_t* g = &graphs[i];
+
+		int8_t degree[PTM_MAX_NBRS];
+		graph_degree(s->num_facets, g->facets, s->num_nbrs, degree);
+		degree_sequences.push_back(degree_sequence_key(s->num_nbrs, degree));
+
+		make_facets_clockwise(s->num_facets, g->facets, &s->points[1]);
+		int ret = canonical_form(s->num_facets, g->facets, s->num_nbrs, degree, g->canonical_labelling, &g->hash);
+		if (ret != PTM_NO_ERROR)
+			return ret;
+
+		hash_index.push_back(std::make_pair(g->hash, i));
+	}
+
+	std::sort(hash_index.begin(), hash_index.end());
+	std::sort(degree_sequences.begin(), degree_sequences.end());
+	degree_sequences.erase(std::unique(degree_sequences.begin(), degree_sequences.end()), degree_sequences.end());
+
+	fprintf(fout, "static const graph_t graphs_%s_canonical[%d] = {\n", s->name, s->num_graphs);
+	for (int i = 0;i<s->num_graphs;i++)
+	{
+		graph_t* g = &graphs[i];
+		fprintf(fout, "\n{%d,\n0x%016llxULL,\n%d,\n%d,\n{", g->id, (unsigned long long)g->hash, g->automorphism_index, g->num_automorphisms);
+		for (int j = 0;j<15;j++)
+			fprintf(fout, "%s%d", j ? ", " : "", g->canonical_labelling[j]);
+		fprintf(fout, "},\n{");
+		for (int j = 0;j<s->num_facets;j++)
+			fprintf(fout, "%s{%d,%d,%d}", j ? "," : "", g->facets[j][0], g->facets[j][1], g->facets[j][2]);
+		fprintf(fout, "}},\n");
+	}
+	fprintf(fout, "\n};\n\n");
+
+	fprintf(fout, "static const graphhash_t hash_index_%s[%d] = {\n", s->name, s->num_graphs);
+	for (int i = 0;i<s->num_graphs;i++)
+		fprintf(fout, "\t{0x%016llxULL, %3d},\n", (unsigned long long)hash_index[i].first, hash_index[i].second);
+	fprintf(fout, "};\n\n");
+
+	fprintf(fout, "static const uint64_t degree_sequences_%s[%d] = {\n", s->name, (int)degree_sequences.size());
+	for (size_t i = 0;i<degree_sequences.size();i++)
+		fprintf(fout, "\t0x%09llxULL,\n", (unsigned long long)degree_sequences[i]);
+	fprintf(fout, "};\n\n");
+
+	//template points permuted by each automorphism and canonical labelling, printed to round-trip exactly
+	int num_templates = 0;
+	fprintf(fout, "static const int32_t first_template_%s[%d] = {", s->name, s->num_graphs);
+	for (int i = 0;i<s->num_graphs;i++)
+	{
+		fprintf(fout, "%s%d", i ? ", " : "", num_templates);
+		num_templates += graphs[i].num_automorphisms;
+	}
+	fprintf(fout, "};\n\n");
+
+	fprintf(fout, "static const permutedtemplate_t templates_%s[%d] = {\n", s->name, num_templates);
+	for (int i = 0;i<s->num_graphs;i++)
+	{
+		graph_t* g = &graphs[i];
+		for (int j = 0;j<g->num_automorphisms;j++)
+		{
+			double points[PTM_MAX_POINTS][3] = {{0}};
+			int8_t template_index[PTM_MAX_POINTS] = {0};
+			for (int k = 0;k<s->num_nbrs + 1;k++)
+			{
+				int label = g->canonical_labelling[k];
+				int index = automorphisms[g->automorphism_index + j][k];
+				template_index[label] = index;
+				memcpy(points[label], s->points[index], 3 * sizeof(double));
+			}
+
+			fprintf(fout, "{{");
+			for (int k = 0;k<PTM_MAX_POINTS;k++)
+				fprintf(fout, "%s{%.17g,%.17g,%.17g}", k ? "," : "", points[k][0], points[k][1], points[k][2]);
+			fprintf(fout, "},\n{");
+			for (int k = 0;k<PTM_MAX_POINTS;k++)
+				fprintf(fout, "%s%d", k ? ", " : "", template_index[k]);
+			fprintf(fout, "}},\n");
+		}
+	}
+	fprintf(fout, "};\n\n");
+
+	fprintf(fout, "const graphtable_t graph_table_%s = {%d, graphs_%s_canonical, hash_index_%s, %d, degree_sequences_%s, first_template_%s, templates_%s};\n\n",
+		s->name, s->num_graphs, s->name, s->name, (int)degree_sequences.size(), s->name, s->name, s->name);
+	return PTM_NO_ERROR;
+}
+
+int main()
+{
+	source_t sources[5] = {
+		{"sc",   6,  8, NUM_SC_GRAPHS,  graphs_sc,  ptm_template_sc },
+		{"fcc", 12, 20, NUM_FCC_GRAPHS, graphs_fcc, ptm_template_fcc},
+		{"hcp", 12, 20, NUM_HCP_GRAPHS, graphs_hcp, ptm_template_hcp},
+		{"ico", 12, 20, NUM_ICO_GRAPHS, graphs_ico, ptm_template_ico},
+		{"bcc", 14, 24, NUM_BCC_GRAPHS, graphs_bcc, ptm_template_bcc},
+	};
+
+	FILE* fout = stdout;
+	fprintf(fout, "//Generated by generate_graph_tables from graph_data.cpp.  Do not edit.\n\n");
+	fprintf(fout, "#include \"graph_tables.hpp\"\n\n\n");
+
+	for (int i = 0;i<5;i++)
+	{
+		int ret = write_table(fout, &sources[i]);
+		if (ret != PTM_NO_ERROR)
+		{
+			fprintf(stderr, "canonical form failed for %s graphs\n", sources[i].name);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
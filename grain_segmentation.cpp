@@ -0,0 +1,338 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include "index_ptm.h"
+#include "qcprot/quat.hpp"
+#include "grain_segmentation.h"
+#include "orientation_sum.hpp"
+#include "parallel_ranges.hpp"
+
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+//atoms per block when gathering neighbour pairs
+#define BLOCK_ATOMS 256
+
+//grain chunks per thread when accumulating, for load balance
+#define GRAIN_CHUNKS_PER_THREAD 8
+
+//indexed by match type
+static const int num_structure_nbrs[6] = {0, 12, 12, 14, 12, 6};
+
+//0 = cubic, 1 = hcp, 2 = icosahedral
+static int symmetry_group(int32_t type)
+{
+	if (type == PTM_MATCH_HCP)
+		return 1;
+	else if (type == PTM_MATCH_ICO)
+		return 2;
+	return 0;
+}
+
+//------------------------------------
+//    concurrent union-find
+//------------------------------------
+//Roots are only ever linked below smaller roots, so the root of every cluster ends up as its lowest atom index,
+//whatever order the threads merge in.
+static int32_t find_root(std::atomic<int32_t>* parent, int32_t x)
+{
+	while (true)
+	{
+		int32_t p = parent[x].load(std::memory_order_relaxed);
+		if (p == x)
+			return x;
+
+		//path halving
+		int32_t gp = parent[p].load(std::memory_order_relaxed);
+		if (gp != p)
+			parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+		x = gp;
+	}
+}
+
+static void unite(std::atomic<int32_t>* parent, int32_t a, int32_t b)
+{
+	while (true)
+	{
+		a = find_root(parent, a);
+		b = find_root(parent, b);
+		if (a == b)
+			return;
+
+		if (a < b)
+			std::swap(a, b);
+
+		int32_t expected = a;
+		if (parent[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+			return;
+	}
+}
+
+typedef struct
+{
+	std::vector<double> q0, q1, angles;
+	std::vector<int32_t> a, b;
+} pairgroup_t;
+
+static void join_block(	int64_t begin, int64_t end, int num_atoms, const int32_t* types, const double* q, const int8_t* mapping,
+			int nbr_stride, const int32_t* nbrs, double max_disorientation, std::atomic<int32_t>* parent, pairgroup_t* groups)
+{
+	typedef void (*kernel_t)(int, const double*, const double*, double*);
+	const kernel_t kernels[3] = {quat_disorientations_cubic, quat_disorientations_hcp, quat_disorientations_icosahedral};
+
+	for (int g=0;g<3;g++)
+	{
+		groups[g].q0.clear();
+		groups[g].q1.clear();
+		groups[g].a.clear();
+		groups[g].b.clear();
+	}
+
+	//gather the bonds between atoms which are not yet in the same cluster
+	for (int64_t i=begin;i<end;i++)
+	{
+		int32_t type = types[i];
+		if (type <= PTM_MATCH_NONE || type > PTM_MATCH_SC)
+			continue;
+
+		pairgroup_t* group = &groups[symmetry_group(type)];
+		for (int k=1;k<=num_structure_nbrs[type];k++)
+		{
+			int index = mapping[i * PTM_MAX_POINTS + k];
+			if (index < 1 || index > nbr_stride)
+				continue;
+
+			int32_t j = nbrs[i * nbr_stride + index - 1];
+			if (j < 0 || j >= num_atoms || types[j] != type)
+				continue;
+
+			if (find_root(parent, i) == find_root(parent, j))
+				continue;
+
+			group->q0.insert(group->q0.end(), &q[4 * i], &q[4 * i + 4]);
+			group->q1.insert(group->q1.end(), &q[4 * (int64_t)j], &q[4 * (int64_t)j + 4]);
+			group->a.push_back(i);
+			group->b.push_back(j);
+		}
+	}
+
+	for (int g=0;g<3;g++)
+	{
+		int n = groups[g].a.size();
+		if (n == 0)
+			continue;
+
+		groups[g].angles.resize(n);
+		kernels[g](n, &groups[g].q0[0], &groups[g].q1[0], &groups[g].angles[0]);
+		for (int k=0;k<n;k++)
+			if (groups[g].angles[k] < max_disorientation)
+				unite(parent, groups[g].a[k], groups[g].b[k]);
+	}
+}
+
+//------------------------------------
+//    orientation statistics
+//------------------------------------
+struct ptm_grain_accumulator
+{
+	std::vector<orientationsum_t> grains;
+};
+
+int ptm_segment_grains(	int num_atoms, const int32_t* types, const double* q, const int8_t* mapping,
+			int nbr_stride, const int32_t* nbrs, double max_disorientation, int num_threads,
+			int32_t* grain_ids, ptm_grains_t* grains)
+{
+	if (num_atoms < 0 || nbr_stride < 0 || grains == NULL)
+		return PTM_GRAIN_INVALID_ARGUMENT;
+
+	if (num_atoms > 0 && (types == NULL || q == NULL || mapping == NULL || nbrs == NULL || grain_ids == NULL))
+		return PTM_GRAIN_INVALID_ARGUMENT;
+
+	memset(grains, 0, sizeof(ptm_grains_t));
+	int64_t num_blocks = (num_atoms + BLOCK_ATOMS - 1) / BLOCK_ATOMS;
+	int requested_threads = num_threads;
+	num_threads = num_worker_threads(num_threads, num_blocks, 4);
+
+	//join bonded atoms of the same structure whose disorientation is below the threshold
+	std::vector< std::atomic<int32_t> > parent(num_atoms);
+	parallel_ranges(num_threads, num_atoms, [&](int64_t begin, int64_t end) {
+		for (int64_t i=begin;i<end;i++)
+			parent[i].store(i, std::memory_order_relaxed);
+	});
+
+	parallel_ranges(num_threads, num_blocks, [&](int64_t begin, int64_t end) {
+		pairgroup_t groups[3];
+		for (int64_t b=begin;b<end;b++)
+			join_block(b * BLOCK_ATOMS, MIN((b + 1) * BLOCK_ATOMS, (int64_t)num_atoms), num_atoms, types, q, mapping,
+					nbr_stride, nbrs, max_disorientation, &parent[0], groups);
+	});
+
+	//number the grains in order of their roots, which are their lowest atom indices
+	int32_t num_grains = 0;
+	for (int32_t i=0;i<num_atoms;i++)
+	{
+		bool matched = types[i] > PTM_MATCH_NONE && types[i] <= PTM_MATCH_SC;
+		grain_ids[i] = matched && parent[i].load(std::memory_order_relaxed) == i ? num_grains++ : -1;
+	}
+
+	//only non-roots are written, and only roots are read
+	parallel_ranges(num_threads, num_atoms, [&](int64_t begin, int64_t end) {
+		for (int64_t i=begin;i<end;i++)
+		{
+			if (types[i] <= PTM_MATCH_NONE || types[i] > PTM_MATCH_SC)
+				continue;
+
+			int32_t root = find_root(&parent[0], i);
+			if (root != i)
+				grain_ids[i] = grain_ids[root];
+		}
+	});
+
+	//sizes, types and mean orientations
+	grains->num_grains = num_grains;
+	grains->types = (int32_t*)malloc(MAX(1, num_grains) * sizeof(int32_t));
+	grains->sizes = (int64_t*)malloc(MAX(1, num_grains) * sizeof(int64_t));
+	grains->orientations = (double*)malloc(4 * MAX(1, num_grains) * sizeof(double));
+	grains->spreads = (double*)malloc(MAX(1, num_grains) * sizeof(double));
+	ptm_grain_accumulator_handle_t accumulator = ptm_initialize_grain_accumulator(num_grains);
+	if (grains->types == NULL || grains->sizes == NULL || grains->orientations == NULL || grains->spreads == NULL || accumulator == NULL)
+	{
+		ptm_uninitialize_grain_accumulator(accumulator);
+		ptm_release_grains(grains);
+		return PTM_GRAIN_INVALID_ARGUMENT;
+	}
+
+	int ret = ptm_accumulate_grains(accumulator, num_atoms, grain_ids, types, q, requested_threads);
+	if (ret == PTM_NO_ERROR)
+		ret = ptm_grain_statistics(accumulator, grains->sizes, grains->types, grains->orientations, grains->spreads);
+
+	ptm_uninitialize_grain_accumulator(accumulator);
+	if (ret != PTM_NO_ERROR)
+		ptm_release_grains(grains);
+	return ret;
+}
+
+void ptm_release_grains(ptm_grains_t* grains)
+{
+	if (grains == NULL)
+		return;
+
+	free(grains->types);
+	free(grains->sizes);
+	free(grains->orientations);
+	free(grains->spreads);
+	memset(grains, 0, sizeof(ptm_grains_t));
+}
+
+ptm_grain_accumulator_handle_t ptm_initialize_grain_accumulator(int num_grains)
+{
+	if (num_grains < 0)
+		return NULL;
+
+	ptm_grain_accumulator_handle_t handle = new ptm_grain_accumulator;
+	orientationsum_t empty;
+	memset(&empty, 0, sizeof(orientationsum_t));
+	empty.type = PTM_MATCH_NONE;
+	handle->grains.assign(num_grains, empty);
+	return handle;
+}
+
+void ptm_uninitialize_grain_accumulator(ptm_grain_accumulator_handle_t handle)
+{
+	delete handle;
+}
+
+int ptm_accumulate_grains(	ptm_grain_accumulator_handle_t handle, int num_atoms, const int32_t* grain_ids, const int32_t* types,
+				const double* q, int num_threads)
+{
+	if (handle == NULL || num_atoms < 0)
+		return PTM_GRAIN_INVALID_ARGUMENT;
+
+	if (num_atoms > 0 && (grain_ids == NULL || types == NULL || q == NULL))
+		return PTM_GRAIN_INVALID_ARGUMENT;
+
+	//atoms are sorted by chunks of grains and each thread adds whole chunks, so the extra memory is one index per atom rather
+	//than a partial sum of every grain per thread.  The sort is stable, so atoms are added in index order whatever the scheduling.
+	int32_t num_grains = handle->grains.size();
+	num_threads = num_worker_threads(num_threads, num_atoms, 4096);
+	int64_t num_chunks = MAX(1, MIN((int64_t)num_grains, (int64_t)GRAIN_CHUNKS_PER_THREAD * num_threads));
+	int64_t grains_per_chunk = MAX(1, (num_grains + num_chunks - 1) / num_chunks);
+
+	std::vector< std::vector<int64_t> > offsets(num_threads, std::vector<int64_t>(num_chunks + 1, 0));
+	std::vector<int32_t> order(num_atoms);
+
+	auto valid = [&](int64_t i) {
+		return grain_ids[i] >= 0 && grain_ids[i] < num_grains && types[i] > PTM_MATCH_NONE && types[i] <= PTM_MATCH_SC;
+	};
+
+	parallel_ranges(num_threads, num_threads, [&](int64_t begin, int64_t end) {
+		for (int64_t t=begin;t<end;t++)
+			for (int64_t i=(int64_t)num_atoms * t / num_threads;i<(int64_t)num_atoms * (t + 1) / num_threads;i++)
+				if (valid(i))
+					offsets[t][grain_ids[i] / grains_per_chunk]++;
+	});
+
+	//chunk c of thread t starts at offsets[t][c], after the same chunk of every earlier thread
+	std::vector<int64_t> chunk_start(num_chunks + 1, 0);
+	int64_t total = 0;
+	for (int64_t c=0;c<num_chunks;c++)
+	{
+		chunk_start[c] = total;
+		for (int t=0;t<num_threads;t++)
+		{
+			int64_t count = offsets[t][c];
+			offsets[t][c] = total;
+			total += count;
+		}
+	}
+	chunk_start[num_chunks] = total;
+
+	parallel_ranges(num_threads, num_threads, [&](int64_t begin, int64_t end) {
+		for (int64_t t=begin;t<end;t++)
+			for (int64_t i=(int64_t)num_atoms * t / num_threads;i<(int64_t)num_atoms * (t + 1) / num_threads;i++)
+				if (valid(i))
+					order[offsets[t][grain_ids[i] / grains_per_chunk]++] = i;
+	});
+
+	parallel_ranges(num_worker_threads(num_threads, num_chunks, 1), num_chunks, [&](int64_t begin, int64_t end) {
+		for (int64_t k=chunk_start[begin];k<chunk_start[end];k++)
+		{
+			int32_t i = order[k];
+			orientation_sum_add(&handle->grains[grain_ids[i]], types[i], &q[4 * (size_t)i]);
+		}
+	});
+
+	return PTM_NO_ERROR;
+}
+
+int ptm_grain_statistics(	ptm_grain_accumulator_handle_t handle,
+				int64_t* counts, int32_t* types, double* orientations, double* spreads)
+{
+	if (handle == NULL)
+		return PTM_GRAIN_INVALID_ARGUMENT;
+
+	for (size_t g=0;g<handle->grains.size();g++)
+	{
+		orientationsum_t* s = &handle->grains[g];
+
+		double mean[4], spread;
+		orientation_sum_mean(s, mean, &spread);
+
+		if (counts != NULL)
+			counts[g] = s->count;
+		if (types != NULL)
+			types[g] = s->type;
+		if (orientations != NULL)
+			memcpy(&orientations[4 * g], mean, 4 * sizeof(double));
+		if (spreads != NULL)
+			spreads[g] = spread;
+	}
+
+	return PTM_NO_ERROR;
+}
+
@@ -0,0 +1,62 @@
+#ifndef GRAIN_SEGMENTATION_H
+#define GRAIN_SEGMENTATION_H
+
+#include <stdint.h>
+
+//------------------------------------
+//    definitions
+//------------------------------------
+#define PTM_GRAIN_INVALID_ARGUMENT	-1
+
+//------------------------------------
+//    grain segmentation
+//------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+	int32_t num_grains;
+	int32_t* types;			//structure type of each grain
+	int64_t* sizes;			//number of atoms in each grain
+	double* orientations;		//mean orientation of each grain, 4 per grain
+	double* spreads;		//orientation spread of each grain (radians), as from ptm_grain_statistics
+} ptm_grains_t;
+
+//Groups matched atoms into grains: clusters of atoms of one structure type, joined through their mapped neighbours
+//wherever the disorientation is less than max_disorientation (radians).
+//types, q and mapping are the outputs of ptm_index_batch for the neighbour list nbrs (num_atoms x nbr_stride atom indices).
+//Grains are numbered in order of their lowest atom index, and grain_ids receives the grain of each atom (-1 if unmatched).
+//The arrays in grains are allocated here; release them with ptm_release_grains.
+int ptm_segment_grains(	int num_atoms, const int32_t* types, const double* q, const int8_t* mapping,
+			int nbr_stride, const int32_t* nbrs, double max_disorientation, int num_threads,	//inputs
+			int32_t* grain_ids, ptm_grains_t* grains);						//outputs
+void ptm_release_grains(ptm_grains_t* grains);
+
+//------------------------------------
+//    per-grain orientation statistics
+//------------------------------------
+//Accumulates the orientations of atoms labelled with grain ids 0..num_grains-1, in as many calls as needed (e.g. one per chunk
+//of a large system).  Each atom is brought into the symmetric variant nearest the first atom seen in its grain before it is
+//averaged, and the grain takes its structure type from that atom.
+typedef struct ptm_grain_accumulator* ptm_grain_accumulator_handle_t;
+ptm_grain_accumulator_handle_t ptm_initialize_grain_accumulator(int num_grains);
+void ptm_uninitialize_grain_accumulator(ptm_grain_accumulator_handle_t handle);
+
+//Atoms with a grain id outside 0..num_grains-1 or with an unmatched type are ignored.
+int ptm_accumulate_grains(	ptm_grain_accumulator_handle_t handle, int num_atoms, const int32_t* grain_ids, const int32_t* types,
+				const double* q, int num_threads);
+
+//Writes the atom count, structure type, mean orientation (4 per grain) and orientation spread of every grain.  NULL outputs are skipped.
+//The spread is 2 acos(sqrt(<(q.mean)^2>)) over the grain's aligned orientations, which approaches the rms misorientation angle
+//from the mean for narrow distributions.  Empty grains have type PTM_MATCH_NONE and a zero count, orientation and spread.
+int ptm_grain_statistics(	ptm_grain_accumulator_handle_t handle,
+				int64_t* counts, int32_t* types, double* orientations, double* spreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
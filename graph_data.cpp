@@ -1,7 +1,7 @@
 #include "graph_data.hpp"
 
 
-int8_t automorphisms[53][15] = {
+const int8_t automorphisms[53][15] = {
 	{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14},
 	{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, -1, -1},
 	{  0,  4,  3, 10,  9,  5,  6, 12, 11,  8,  7,  1,  2, -1, -1},
@@ -57,7 +57,7 @@ int8_t automorphisms[53][15] = {
 	{  0, 13, 14, 11, 12,  5,  6, 10,  9,  1,  2,  7,  8,  4,  3},
 };
 
-graph_t graphs_sc[NUM_SC_GRAPHS] = {
+const graph_t graphs_sc[NUM_SC_GRAPHS] = {
 
 {0,
 0,
@@ -68,7 +68,7 @@ graph_t graphs_sc[NUM_SC_GRAPHS] = {
 
 };
 
-graph_t graphs_ico[NUM_ICO_GRAPHS] = {
+const graph_t graphs_ico[NUM_ICO_GRAPHS] = {
 
 {0,
 0,
@@ -79,7 +79,7 @@ graph_t graphs_ico[NUM_ICO_GRAPHS] = {
 
 };
 
-graph_t graphs_fcc[NUM_FCC_GRAPHS] = {
+const graph_t graphs_fcc[NUM_FCC_GRAPHS] = {
 
 {0,
 0,
@@ -143,7 +143,7 @@ graph_t graphs_fcc[NUM_FCC_GRAPHS] = {
 
 };
 
-graph_t graphs_hcp[NUM_HCP_GRAPHS] = {
+const graph_t graphs_hcp[NUM_HCP_GRAPHS] = {
 
 {0,
 0,
@@ -280,7 +280,7 @@ graph_t graphs_hcp[NUM_HCP_GRAPHS] = {
 
 };
 
-graph_t graphs_bcc[NUM_BCC_GRAPHS] = {
+const graph_t graphs_bcc[NUM_BCC_GRAPHS] = {
 
 {0,
 0,
@@ -19,13 +19,15 @@ typedef struct
 #define NUM_HCP_GRAPHS 16
 #define NUM_BCC_GRAPHS 218
 
-extern int8_t automorphisms[][15];
+extern const int8_t automorphisms[][15];
 
-extern graph_t graphs_sc[NUM_SC_GRAPHS];
-extern graph_t graphs_fcc[NUM_FCC_GRAPHS];
-extern graph_t graphs_hcp[NUM_HCP_GRAPHS];
-extern graph_t graphs_ico[NUM_ICO_GRAPHS];
-extern graph_t graphs_bcc[NUM_BCC_GRAPHS];
+//source reference graphs, as input to generate_graph_tables; indexing uses the tables in graph_tables.hpp
+
+extern const graph_t graphs_sc[NUM_SC_GRAPHS];
+extern const graph_t graphs_fcc[NUM_FCC_GRAPHS];
+extern const graph_t graphs_hcp[NUM_HCP_GRAPHS];
+extern const graph_t graphs_ico[NUM_ICO_GRAPHS];
+extern const graph_t graphs_bcc[NUM_BCC_GRAPHS];
 
 #endif
 
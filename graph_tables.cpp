@@ -0,0 +1,2685 @@
+//Generated by generate_graph_tables from graph_data.cpp.  Do not edit.
+
+#include "graph_tables.hpp"
+
+
+static const graph_t graphs_sc_canonical[1] = {
+
+{0,
+0x9b6373501e242545ULL,
+0,
+1,
+{0, 4, 2, 6, 1, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+{{3,1,4},{1,3,5},{0,3,4},{3,0,5},{2,1,5},{1,2,4},{2,0,4},{0,2,5}}},
+
+};
+
+static const graphhash_t hash_index_sc[1] = {
+	{0x9b6373501e242545ULL,   0},
+};
+
+static const uint64_t degree_sequences_sc[1] = {
+	0x000060000ULL,
+};
+
+static const int32_t first_template_sc[1] = {0};
+
+static const permutedtemplate_t templates_sc[1] = {
+{{{0,0,0},{0,1,0},{0,0,1},{-1,0,0},{0,0,-1},{1,0,0},{0,-1,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}},
+{0, 4, 2, 5, 1, 6, 3, 0, 0, 0, 0, 0, 0, 0, 0}},
+};
+
+const graphtable_t graph_table_sc = {1, graphs_sc_canonical, hash_index_sc, 1, degree_sequences_sc, first_template_sc, templates_sc};
+
+static const graph_t graphs_fcc_canonical[8] = {
+
+{0,
+0xdfdbf437e4307e7aULL,
+0,
+1,
+{0, 7, 11, 12, 3, 2, 5, 9, 1, 8, 4, 10, 6, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,5,11},{5,7,9},{2,1,6},{1,2,5},{1,3,10},{3,1,9},{4,6,10},{6,4,8}}},
+
+{1,
+0xd0fbe4c7e4304c5bULL,
+0,
+1,
+{0, 9, 1, 2, 5, 12, 3, 7, 11, 8, 4, 6, 10, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,5,11},{5,7,9},{2,1,6},{1,2,5},{1,3,10},{3,1,9},{8,6,10},{4,8,10}}},
+
+{2,
+0x782bee7e385a4ce1ULL,
+0,
+1,
+{0, 2, 11, 8, 4, 3, 6, 12, 1, 9, 5, 10, 7, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,5,11},{5,7,9},{2,1,6},{1,2,5},{9,3,10},{1,9,10},{8,6,10},{4,8,10}}},
+
+{3,
+0x1fab28d8da5f7849ULL,
+0,
+1,
+{0, 7, 11, 12, 3, 2, 5, 9, 1, 8, 4, 10, 6, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,5,11},{5,7,9},{2,5,6},{5,1,6},{1,3,10},{3,1,9},{4,6,10},{6,4,8}}},
+
+{4,
+0xa73be4c7e4304c5bULL,
+0,
+1,
+{0, 4, 8, 10, 6, 5, 2, 9, 1, 11, 7, 12, 3, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,5,11},{5,7,9},{2,5,6},{5,1,6},{1,3,10},{3,1,9},{8,6,10},{4,8,10}}},
+
+{5,
+0x2fab28d8da5f4c59ULL,
+0,
+1,
+{0, 3, 12, 11, 7, 1, 9, 5, 2, 4, 8, 6, 10, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,5,11},{5,7,9},{2,5,6},{5,1,6},{9,3,10},{1,9,10},{4,6,10},{6,4,8}}},
+
+{6,
+0x782bee7e385a4ce1ULL,
+0,
+1,
+{0, 3, 11, 10, 7, 1, 12, 5, 2, 4, 8, 6, 9, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,9,11},{9,5,11},{2,1,6},{1,2,5},{9,3,10},{1,9,10},{4,6,10},{6,4,8}}},
+
+{7,
+0xd5351a8ea36a7ec3ULL,
+1,
+5,
+{0, 2, 10, 8, 5, 1, 12, 9, 6, 3, 11, 4, 7, 0, 0},
+{{4,0,8},{7,3,9},{5,2,11},{0,7,11},{1,5,9},{2,6,8},{3,4,10},{6,1,10},{4,3,7},{0,4,7},{2,0,11},{0,2,8},{7,9,11},{9,5,11},{2,5,6},{5,1,6},{1,3,10},{3,1,9},{8,6,10},{4,8,10}}},
+
+};
+
+static const graphhash_t hash_index_fcc[8] = {
+	{0x1fab28d8da5f7849ULL,   3},
+	{0x2fab28d8da5f4c59ULL,   5},
+	{0x782bee7e385a4ce1ULL,   2},
+	{0x782bee7e385a4ce1ULL,   6},
+	{0xa73be4c7e4304c5bULL,   4},
+	{0xd0fbe4c7e4304c5bULL,   1},
+	{0xd5351a8ea36a7ec3ULL,   7},
+	{0xdfdbf437e4307e7aULL,   0},
+};
+
+static const uint64_t degree_sequences_fcc[4] = {
+	0x000c00000ULL,
+	0x002820000ULL,
+	0x003630000ULL,
+	0x004440000ULL,
+};
+
+static const int32_t first_template_fcc[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+static const permutedtemplate_t templates_fcc[12] = {
+{{{0,0,0},{-0.70710678118699999,0,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{0,0.70710678118699999,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 8, 5, 4, 10, 6, 12, 1, 9, 7, 11, 2, 3, 0, 0}},
+{{{0,0,0},{0,-0.70710678118699999,-0.70710678118699999},{0,0.70710678118699999,-0.70710678118699999},{-0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{-0.70710678118699999,0,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 2, 3, 6, 10, 4, 11, 7, 9, 1, 12, 8, 5, 0, 0}},
+{{{0,0,0},{-0.70710678118699999,0,0.70710678118699999},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 8, 1, 5, 4, 10, 6, 12, 3, 9, 11, 2, 7, 0, 0}},
+{{{0,0,0},{-0.70710678118699999,0,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{0,0.70710678118699999,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 8, 5, 4, 10, 6, 12, 1, 9, 7, 11, 2, 3, 0, 0}},
+{{{0,0,0},{-0.70710678118699999,0,0.70710678118699999},{-0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0,-0.70710678118699999},{0,0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,-0.70710678118699999,0},{0,0,0},{0,0,0}},
+{0, 8, 6, 12, 1, 5, 4, 10, 2, 7, 3, 9, 11, 0, 0}},
+{{{0,0,0},{0.70710678118699999,0,0.70710678118699999},{-0.70710678118699999,0,0.70710678118699999},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,-0.70710678118699999},{0,-0.70710678118699999,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 5, 8, 1, 9, 7, 11, 4, 10, 6, 12, 3, 2, 0, 0}},
+{{{0,0,0},{0.70710678118699999,0,0.70710678118699999},{-0.70710678118699999,0,0.70710678118699999},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,-0.70710678118699999},{0,-0.70710678118699999,-0.70710678118699999},{-0.70710678118699999,0,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 5, 8, 1, 9, 7, 11, 4, 10, 12, 3, 2, 6, 0, 0}},
+{{{0,0,0},{0.70710678118699999,0,0.70710678118699999},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,0,0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0,-0.70710678118699999},{0,-0.70710678118699999,-0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 5, 1, 9, 11, 4, 8, 12, 3, 7, 2, 10, 6, 0, 0}},
+{{{0,0,0},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,0,0.70710678118699999},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 5, 4, 8, 1, 9, 11, 2, 10, 12, 3, 7, 6, 0, 0}},
+{{{0,0,0},{-0.70710678118699999,0,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{-0.70710678118699999,0,-0.70710678118699999},{0,0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 8, 5, 4, 10, 12, 1, 9, 11, 2, 6, 3, 7, 0, 0}},
+{{{0,0,0},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,0,0.70710678118699999},{0.70710678118699999,0,0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,0,-0.70710678118699999},{-0.70710678118699999,0,-0.70710678118699999},{0,0.70710678118699999,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 4, 8, 5, 11, 2, 10, 12, 1, 9, 7, 6, 3, 0, 0}},
+{{{0,0,0},{0,0.70710678118699999,0.70710678118699999},{-0.70710678118699999,0,0.70710678118699999},{-0.70710678118699999,0.70710678118699999,0},{0,0.70710678118699999,-0.70710678118699999},{0.70710678118699999,0.70710678118699999,0},{0.70710678118699999,0,0.70710678118699999},{0,-0.70710678118699999,0.70710678118699999},{-0.70710678118699999,-0.70710678118699999,0},{-0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,0,-0.70710678118699999},{0.70710678118699999,-0.70710678118699999,0},{0,-0.70710678118699999,-0.70710678118699999},{0,0,0},{0,0,0}},
+{0, 1, 8, 12, 3, 9, 5, 4, 10, 6, 7, 11, 2, 0, 0}},
+};
+
+const graphtable_t graph_table_fcc = {8, graphs_fcc_canonical, hash_index_fcc, 4, degree_sequences_fcc, first_template_fcc, templates_fcc};
+
+static const graph_t graphs_hcp_canonical[16] = {
+
+{0,
+0x31f884d7e4304c57ULL,
+0,
+1,
+{0, 5, 3, 6, 2, 12, 10, 9, 8, 7, 1, 11, 4, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{2,8,9},{0,2,9},{10,0,11},{4,0,10},{2,6,7},{2,4,6}}},
+
+{1,
+0xd0fbe4c7e4304c5bULL,
+0,
+1,
+{0, 5, 3, 6, 2, 12, 10, 9, 8, 7, 1, 11, 4, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{2,8,9},{0,2,9},{10,0,11},{4,0,10},{4,6,7},{2,4,7}}},
+
+{2,
+0x31f884d7e43cfb57ULL,
+0,
+1,
+{0, 5, 3, 6, 2, 12, 10, 9, 8, 7, 1, 11, 4, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{2,8,9},{0,2,9},{10,4,11},{4,0,11},{2,6,7},{2,4,6}}},
+
+{3,
+0xd0fbe4c7e43cfb5bULL,
+0,
+1,
+{0, 5, 3, 6, 2, 12, 10, 9, 8, 7, 1, 11, 4, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{2,8,9},{0,2,9},{10,4,11},{4,0,11},{4,6,7},{2,4,7}}},
+
+{4,
+0xa73f84c7e43cfb5bULL,
+0,
+1,
+{0, 8, 10, 6, 4, 7, 3, 1, 5, 12, 11, 2, 9, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{0,8,9},{0,2,8},{10,0,11},{4,0,10},{2,6,7},{2,4,6}}},
+
+{5,
+0xdfebe4c7e4304c5bULL,
+0,
+1,
+{0, 1, 8, 4, 12, 3, 9, 10, 11, 5, 6, 2, 7, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{0,8,9},{0,2,8},{10,0,11},{4,0,10},{4,6,7},{2,4,7}}},
+
+{6,
+0xa73be4c7e4304c5bULL,
+6,
+2,
+{0, 11, 8, 4, 2, 5, 7, 1, 3, 10, 9, 6, 12, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{0,8,9},{0,2,8},{10,4,11},{4,0,11},{2,6,7},{2,4,6}}},
+
+{7,
+0xa43bfe8ae4307e7aULL,
+0,
+1,
+{0, 9, 7, 10, 1, 11, 6, 5, 4, 3, 2, 12, 8, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,3,9},{3,1,9},{0,8,9},{0,2,8},{10,4,11},{4,0,11},{4,6,7},{2,4,7}}},
+
+{8,
+0xa73be4c7e43cfb5bULL,
+0,
+1,
+{0, 6, 2, 12, 10, 5, 3, 4, 11, 9, 8, 1, 7, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,1,9},{3,1,8},{2,8,9},{0,2,9},{10,0,11},{4,0,10},{2,6,7},{2,4,6}}},
+
+{9,
+0xa73be4c7e4304c5bULL,
+8,
+2,
+{0, 10, 1, 11, 6, 9, 7, 8, 12, 5, 4, 2, 3, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,1,9},{3,1,8},{2,8,9},{0,2,9},{10,0,11},{4,0,10},{4,6,7},{2,4,7}}},
+
+{10,
+0xa43bfe8ae4307e4bULL,
+0,
+1,
+{0, 9, 1, 10, 5, 8, 6, 12, 11, 4, 3, 7, 2, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,1,9},{3,1,8},{2,8,9},{0,2,9},{10,4,11},{4,0,11},{4,6,7},{2,4,7}}},
+
+{11,
+0x31fb94d7c4304c95ULL,
+0,
+1,
+{0, 8, 1, 9, 3, 12, 4, 11, 10, 2, 7, 5, 6, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,1,9},{3,1,8},{0,8,9},{0,2,8},{10,0,11},{4,0,10},{4,6,7},{2,4,7}}},
+
+{12,
+0xd0fbe4c7e4304c5bULL,
+0,
+1,
+{0, 8, 1, 9, 3, 12, 4, 11, 10, 2, 7, 5, 6, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,3,7},{5,3,6},{8,1,9},{3,1,8},{0,8,9},{0,2,8},{10,4,11},{4,0,11},{2,6,7},{2,4,6}}},
+
+{13,
+0x782bee7e385a4ce1ULL,
+10,
+2,
+{0, 6, 2, 11, 9, 5, 3, 4, 10, 12, 8, 1, 7, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,5,7},{5,3,7},{8,3,9},{3,1,9},{2,8,9},{0,2,9},{10,0,11},{4,0,10},{4,6,7},{2,4,7}}},
+
+{14,
+0xd5351a8ea36a7ec3ULL,
+12,
+10,
+{0, 11, 1, 12, 2, 10, 3, 9, 8, 7, 6, 4, 5, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{1,10,11},{1,5,10},{6,5,7},{5,3,7},{8,3,9},{3,1,9},{0,8,9},{0,2,8},{10,4,11},{4,0,11},{2,6,7},{2,4,6}}},
+
+{15,
+0xd5351a8ea36a7ec3ULL,
+22,
+10,
+{0, 10, 1, 11, 2, 12, 3, 8, 7, 6, 5, 9, 4, 0, 0},
+{{1,3,5},{5,6,10},{0,9,11},{9,1,11},{7,3,8},{2,7,8},{6,4,10},{2,0,4},{5,10,11},{1,5,11},{6,3,7},{5,3,6},{8,1,9},{3,1,8},{2,8,9},{0,2,9},{10,0,11},{4,0,10},{4,6,7},{2,4,7}}},
+
+};
+
+static const graphhash_t hash_index_hcp[16] = {
+	{0x31f884d7e4304c57ULL,   0},
+	{0x31f884d7e43cfb57ULL,   2},
+	{0x31fb94d7c4304c95ULL,  11},
+	{0x782bee7e385a4ce1ULL,  13},
+	{0xa43bfe8ae4307e4bULL,  10},
+	{0xa43bfe8ae4307e7aULL,   7},
+	{0xa73be4c7e4304c5bULL,   6},
+	{0xa73be4c7e4304c5bULL,   9},
+	{0xa73be4c7e43cfb5bULL,   8},
+	{0xa73f84c7e43cfb5bULL,   4},
+	{0xd0fbe4c7e4304c5bULL,   1},
+	{0xd0fbe4c7e4304c5bULL,  12},
+	{0xd0fbe4c7e43cfb5bULL,   3},
+	{0xd5351a8ea36a7ec3ULL,  14},
+	{0xd5351a8ea36a7ec3ULL,  15},
+	{0xdfebe4c7e4304c5bULL,   5},
+};
+
+static const uint64_t degree_sequences_hcp[5] = {
+	0x000c00000ULL,
+	0x002820000ULL,
+	0x003630000ULL,
+	0x004440000ULL,
+	0x005250000ULL,
+};
+
+static const int32_t first_template_hcp[16] = {0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 17, 27};
+
+static const permutedtemplate_t templates_hcp[37] = {
+{{{0,0,0},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 10, 4, 2, 12, 1, 3, 9, 8, 7, 6, 11, 5, 0, 0}},
+{{{0,0,0},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 10, 4, 2, 12, 1, 3, 9, 8, 7, 6, 11, 5, 0, 0}},
+{{{0,0,0},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 10, 4, 2, 12, 1, 3, 9, 8, 7, 6, 11, 5, 0, 0}},
+{{{0,0,0},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 10, 4, 2, 12, 1, 3, 9, 8, 7, 6, 11, 5, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 7, 11, 6, 4, 8, 3, 5, 1, 12, 2, 10, 9, 0, 0}},
+{{{0,0,0},{0.70710678118600001,0,0.70710678118600001},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0,0},{0,0,0}},
+{0, 1, 11, 5, 3, 9, 10, 12, 2, 6, 7, 8, 4, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{-0.70710678118600001,0,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 7, 4, 8, 3, 5, 11, 6, 2, 10, 9, 1, 12, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.70710678118600001,0.70710678118600001,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 4, 7, 6, 2, 10, 9, 8, 3, 5, 11, 12, 1, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{-0.70710678118600001,0,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 4, 10, 9, 8, 7, 6, 2, 12, 1, 3, 5, 11, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 11, 2, 6, 7, 5, 1, 12, 10, 9, 4, 8, 3, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 2, 11, 12, 10, 9, 4, 6, 7, 5, 1, 3, 8, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 11, 2, 6, 7, 5, 1, 12, 10, 9, 4, 8, 3, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 2, 12, 10, 9, 4, 6, 11, 5, 1, 3, 8, 7, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 2, 9, 4, 6, 11, 12, 10, 1, 3, 8, 7, 5, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 2, 9, 4, 6, 11, 12, 10, 1, 3, 8, 7, 5, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 11, 2, 6, 7, 5, 1, 12, 10, 4, 8, 3, 9, 0, 0}},
+{{{0,0,0},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 10, 1, 3, 9, 4, 2, 12, 11, 5, 8, 6, 7, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 2, 4, 6, 11, 12, 10, 9, 8, 7, 5, 1, 3, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 7, 11, 6, 8, 3, 5, 12, 2, 4, 9, 1, 10, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 11, 2, 6, 7, 5, 12, 10, 4, 8, 3, 1, 9, 0, 0}},
+{{{0,0,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 6, 11, 2, 4, 8, 7, 5, 12, 10, 9, 3, 1, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 11, 12, 2, 6, 7, 5, 1, 10, 4, 8, 3, 9, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 2, 11, 12, 10, 4, 6, 7, 5, 1, 9, 8, 3, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 2, 6, 11, 12, 10, 4, 8, 7, 5, 1, 9, 3, 0, 0}},
+{{{0,0,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 6, 7, 11, 2, 4, 8, 3, 5, 12, 10, 9, 1, 0, 0}},
+{{{0,0,0},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 12, 2, 11, 5, 1, 10, 4, 6, 7, 3, 9, 8, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 11, 6, 7, 5, 12, 2, 4, 8, 3, 1, 10, 9, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.94280904158300005,-0.235702260395,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 2, 4, 6, 12, 10, 9, 8, 7, 11, 1, 3, 5, 0, 0}},
+{{{0,0,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 2, 6, 12, 10, 9, 4, 7, 11, 1, 3, 8, 5, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 11, 6, 7, 5, 1, 12, 2, 4, 8, 3, 10, 9, 0, 0}},
+{{{0,0,0},{0,-0.70710678118600001,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 12, 6, 11, 1, 10, 2, 4, 7, 5, 3, 9, 8, 0, 0}},
+{{{0,0,0},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 12, 2, 6, 11, 1, 10, 9, 4, 7, 5, 3, 8, 0, 0}},
+{{{0,0,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 6, 12, 2, 4, 7, 11, 1, 10, 9, 8, 5, 3, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0,0},{0,0,0}},
+{0, 11, 12, 6, 7, 5, 1, 10, 2, 4, 8, 3, 9, 0, 0}},
+{{{0,0,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{-0.70710678118600001,0.70710678118600001,0},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0,0.70710678118600001,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 6, 11, 12, 2, 4, 7, 5, 1, 10, 9, 8, 3, 0, 0}},
+{{{0,0,0},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0.70710678118600001,-0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 7, 11, 6, 4, 8, 5, 1, 12, 2, 9, 3, 10, 0, 0}},
+{{{0,0,0},{-0.94280904158300005,-0.235702260395,-0.235702260395},{-0.70710678118600001,0.70710678118600001,0},{-0.70710678118600001,0,0.70710678118600001},{0,-0.70710678118600001,0.70710678118600001},{-0.235702260395,-0.94280904158300005,-0.235702260395},{-0.235702260395,-0.235702260395,-0.94280904158300005},{0,0.70710678118600001,-0.70710678118600001},{0,0.70710678118600001,0.70710678118600001},{0.70710678118600001,0,0.70710678118600001},{0.70710678118600001,-0.70710678118600001,0},{0.70710678118600001,0,-0.70710678118600001},{0.70710678118600001,0.70710678118600001,0},{0,0,0},{0,0,0}},
+{0, 6, 7, 11, 12, 2, 4, 8, 5, 1, 10, 9, 3, 0, 0}},
+};
+
+const graphtable_t graph_table_hcp = {16, graphs_hcp_canonical, hash_index_hcp, 5, degree_sequences_hcp, first_template_hcp, templates_hcp};
+
+static const graph_t graphs_ico_canonical[1] = {
+
+{0,
+0xd5351a8ea36a7ec3ULL,
+0,
+1,
+{0, 1, 12, 7, 4, 10, 2, 9, 6, 11, 3, 8, 5, 0, 0},
+{{0,5,9},{1,2,8},{5,0,7},{2,7,8},{2,5,7},{4,1,8},{2,1,10},{9,5,10},{5,2,10},{4,8,11},{8,7,11},{7,0,11},{3,0,9},{0,3,11},{3,4,11},{6,3,9},{4,3,6},{6,9,10},{1,4,6},{1,6,10}}},
+
+};
+
+static const graphhash_t hash_index_ico[1] = {
+	{0xd5351a8ea36a7ec3ULL,   0},
+};
+
+static const uint64_t degree_sequences_ico[1] = {
+	0x000c00000ULL,
+};
+
+static const int32_t first_template_ico[1] = {0};
+
+static const permutedtemplate_t templates_ico[1] = {
+{{{0,0,0},{0,0.52573111211900003,0.85065080835200002},{0.52573111211900003,0.85065080835200002,0},{0.85065080835200002,0,0.52573111211900003},{0,-0.52573111211900003,0.85065080835200002},{-0.85065080835200002,0,0.52573111211900003},{-0.52573111211900003,0.85065080835200002,0},{0,0.52573111211900003,-0.85065080835200002},{0.85065080835200002,0,-0.52573111211900003},{0.52573111211900003,-0.85065080835200002,0},{-0.52573111211900003,-0.85065080835200002,0},{-0.85065080835200002,0,-0.52573111211900003},{0,-0.52573111211900003,-0.85065080835200002},{0,0,0},{0,0,0}},
+{0, 1, 6, 10, 4, 12, 8, 3, 11, 7, 5, 9, 2, 0, 0}},
+};
+
+const graphtable_t graph_table_ico = {1, graphs_ico_canonical, hash_index_ico, 1, degree_sequences_ico, first_template_ico, templates_ico};
+
+static const graph_t graphs_bcc_canonical[218] = {
+
+{0,
+0x380e64d7a9dcda4aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{1,
+0x38174fb1acdcda4aULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{2,
+0xacf75aa101def12aULL,
+0,
+1,
+{0, 5, 10, 13, 9, 7, 12, 3, 14, 6, 2, 4, 8, 1, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{3,
+0xc5475aa16e07d1a7ULL,
+0,
+1,
+{0, 14, 3, 13, 9, 10, 5, 7, 12, 11, 1, 6, 2, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{4,
+0x38174fb103dcda4aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{5,
+0xb53ebfb16e07d1a9ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{6,
+0x38170a9101ddda4aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{7,
+0xb43efa916e07d1a7ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{8,
+0xacb23acc00def12aULL,
+0,
+1,
+{0, 14, 3, 13, 9, 10, 5, 7, 12, 11, 1, 6, 2, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{9,
+0xc5023ae75ed9d4a6ULL,
+0,
+1,
+{0, 14, 3, 13, 9, 10, 5, 7, 12, 11, 1, 6, 2, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{10,
+0xb51f219404def12aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{11,
+0xb51f21a05a16722fULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{12,
+0xacf75ac201def12aULL,
+0,
+1,
+{0, 14, 3, 13, 9, 10, 5, 7, 12, 11, 1, 6, 2, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{13,
+0xc5475ae75ed9d6a7ULL,
+0,
+1,
+{0, 14, 3, 13, 9, 10, 5, 7, 12, 11, 1, 6, 2, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{14,
+0xacb29dcc00def12aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{15,
+0xc50278970cdad4a6ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{16,
+0x9af73fb2e0d81ee9ULL,
+0,
+1,
+{0, 12, 9, 13, 3, 5, 10, 11, 7, 6, 2, 14, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{17,
+0xb510f8e0d317403fULL,
+0,
+1,
+{0, 10, 5, 12, 7, 9, 13, 14, 3, 2, 6, 11, 1, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{18,
+0xebe63c893d18efdcULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{19,
+0xc5475af4d2d8e4b7ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 9, 13, 14, 3, 2, 6, 11, 1, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{20,
+0x8cc7557e82d9190cULL,
+0,
+1,
+{0, 11, 7, 12, 9, 3, 13, 10, 5, 4, 8, 14, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{21,
+0xa4553fda8bb863b7ULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{22,
+0x8ce26ddf8bb863aeULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{23,
+0xa455cb80c3376eb7ULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{24,
+0xfce2888480dbe687ULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{25,
+0xebc63e99cf18efdcULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{26,
+0xfbc63e99c3f9ecbcULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{27,
+0xc502770ec1da1be6ULL,
+0,
+1,
+{0, 12, 9, 14, 3, 5, 10, 11, 7, 6, 2, 13, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{28,
+0x6cf2775983da3cacULL,
+0,
+1,
+{0, 12, 9, 13, 3, 5, 10, 11, 7, 6, 2, 14, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{29,
+0xb55598da8cdfc33aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{30,
+0xb55598e0d337703fULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{31,
+0xacb23adf8cdfc33aULL,
+0,
+1,
+{0, 10, 5, 12, 7, 9, 13, 14, 3, 2, 6, 11, 1, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{32,
+0xb555cb80c337703fULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{33,
+0xc5023af4d2d8e6b6ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{34,
+0xacb29ddf8cdfc33aULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{35,
+0xc502788480dbe6b6ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{36,
+0x69753ddb8bb863b7ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{37,
+0x6975cb8023476eb7ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{38,
+0x69963ddb8bb863b7ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{39,
+0x69aaeb9023476eb7ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{40,
+0x41c26fde8bb863aeULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{41,
+0x31c2888480dde787ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{42,
+0x41216fde8bb863aeULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{43,
+0x310cb8d28fdde787ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{44,
+0x95e85d23c006bc6eULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{45,
+0x8dd62023c2f9ecbcULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{46,
+0x6cf2775980934eccULL,
+0,
+1,
+{0, 12, 9, 13, 3, 5, 10, 11, 7, 6, 2, 14, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{47,
+0x959e4d1dc0268c6eULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{48,
+0x959e4d17d0268c6eULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{49,
+0x6dd0301dc1a19edcULL,
+0,
+1,
+{0, 10, 5, 12, 7, 9, 13, 14, 3, 2, 6, 11, 1, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{50,
+0x7dc24610e0aebefeULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{51,
+0x6dd0301dc2f9ecbcULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{52,
+0x6dd03011e3f6ccacULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 12, 13, 9, 8, 4, 11, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{53,
+0x6dd03011e0aebeccULL,
+0,
+1,
+{0, 10, 5, 12, 7, 9, 13, 14, 3, 2, 6, 11, 1, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{54,
+0x810ff2598ffeaedeULL,
+0,
+1,
+{0, 12, 9, 13, 3, 5, 10, 11, 7, 6, 2, 14, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{55,
+0xbed1bd8d13bee0e6ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{56,
+0xbd6f3416330ee0e6ULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{57,
+0x7fd23410e0aebedeULL,
+0,
+1,
+{0, 12, 7, 13, 9, 3, 14, 10, 5, 4, 8, 11, 1, 2, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{58,
+0xbd6f3206330ee0e6ULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{59,
+0x7fd23071e34eaedeULL,
+0,
+1,
+{0, 13, 9, 14, 3, 5, 10, 12, 7, 6, 2, 11, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{60,
+0x0c6b30a90b9eac02ULL,
+0,
+1,
+{0, 12, 9, 13, 3, 5, 10, 11, 7, 6, 2, 14, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{61,
+0xafadda4d55718c98ULL,
+0,
+1,
+{0, 13, 8, 11, 6, 14, 3, 4, 9, 10, 1, 12, 7, 5, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{62,
+0x4dadfa5d55718c91ULL,
+0,
+1,
+{0, 4, 9, 13, 8, 6, 11, 3, 14, 5, 2, 12, 7, 1, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{63,
+0x15028177e2b448b8ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{64,
+0x15028efce2b448b8ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{65,
+0x15028407e2b448b8ULL,
+0,
+1,
+{0, 4, 9, 13, 8, 6, 11, 3, 14, 5, 2, 12, 7, 1, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{66,
+0x15028b8ce2b448b8ULL,
+0,
+1,
+{0, 4, 9, 13, 8, 6, 11, 3, 14, 5, 2, 12, 7, 1, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{67,
+0xc7028177e2b44ab7ULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{68,
+0xc7028407e2b44ab7ULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{69,
+0xc7028efce2b44ab7ULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{70,
+0xc7028b8ce2b44ab7ULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{71,
+0xf3f27451a3fc2809ULL,
+0,
+1,
+{0, 11, 8, 13, 3, 5, 9, 10, 6, 12, 2, 14, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{72,
+0xf3f27406a3fc2809ULL,
+0,
+1,
+{0, 11, 8, 13, 3, 5, 9, 10, 6, 12, 2, 14, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{73,
+0x8dd7d0d2991ffa8dULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{74,
+0x7cc0f01089edfefeULL,
+0,
+1,
+{0, 6, 11, 14, 3, 8, 13, 4, 9, 7, 12, 5, 2, 1, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{75,
+0x8dd7d0d2c1cffa8dULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{76,
+0x8dd7d0d2c13efa8dULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{77,
+0x81018bdbaffd0851ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{78,
+0x31018b9caffd08b8ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{79,
+0x31018bdbaffd08b8ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{80,
+0x7cc0f010d13dfefeULL,
+0,
+1,
+{0, 6, 11, 4, 9, 14, 3, 8, 13, 5, 2, 1, 10, 7, 12},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{81,
+0x68f2899d33c08188ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{82,
+0x81018450affd0851ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{83,
+0x31018417affd08b8ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{84,
+0x31018450affd08b8ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{85,
+0x729df5d655718c94ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{86,
+0x729dfa5d55718c94ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{87,
+0x7dd7d010d13dfefdULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{88,
+0x7cc0b600ef31ceceULL,
+0,
+1,
+{0, 6, 11, 14, 3, 8, 13, 4, 9, 7, 12, 5, 2, 1, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{89,
+0x19e18417afb548b8ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{90,
+0x19e18b9cafb548b8ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{91,
+0xe67a5910bbf1d275ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{92,
+0xe67a591089e1e275ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{93,
+0x429df5d655718c91ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{94,
+0x429dfa5d55718c91ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{95,
+0xe0d7d010d13dfef9ULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{96,
+0xe0d7d010e03dfef9ULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{97,
+0x19ecb417afb548b8ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{98,
+0x19ecbb9cafb548b8ULL,
+0,
+1,
+{0, 13, 8, 4, 9, 11, 6, 14, 3, 12, 7, 5, 2, 10, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{99,
+0x0c0ff151e62d2358ULL,
+0,
+1,
+{0, 11, 8, 13, 3, 5, 9, 10, 6, 12, 2, 14, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{100,
+0x0c0f2251e62d2358ULL,
+0,
+1,
+{0, 11, 8, 13, 3, 5, 9, 10, 6, 12, 2, 14, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{101,
+0xc52623a9ee600d89ULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{102,
+0xcdc5df88e2be0bb6ULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{103,
+0x19e18417126108b8ULL,
+0,
+1,
+{0, 4, 9, 12, 8, 6, 10, 3, 14, 5, 2, 11, 7, 1, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{104,
+0x81018450affd0851ULL,
+0,
+1,
+{0, 13, 3, 12, 8, 9, 4, 6, 10, 14, 1, 5, 2, 7, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{105,
+0x9db72c33cedffdbcULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{106,
+0x5cc65613c13efeeeULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{107,
+0x19ecb41712fd08b8ULL,
+0,
+1,
+{0, 14, 3, 12, 8, 9, 4, 6, 10, 13, 1, 5, 2, 7, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{108,
+0x810c6751affd2ec1ULL,
+0,
+1,
+{0, 13, 3, 12, 8, 9, 4, 6, 10, 14, 1, 5, 2, 7, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{109,
+0x8db72c33c13efedcULL,
+0,
+1,
+{0, 12, 7, 10, 5, 13, 8, 3, 14, 11, 1, 2, 6, 4, 9},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{110,
+0x81018450e62d2ec1ULL,
+0,
+1,
+{0, 13, 3, 12, 8, 9, 4, 6, 10, 14, 1, 5, 2, 7, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{111,
+0x19e1841712fd08b8ULL,
+0,
+1,
+{0, 14, 3, 12, 8, 9, 4, 6, 10, 13, 1, 5, 2, 7, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{112,
+0x81018450affd2ec1ULL,
+0,
+1,
+{0, 13, 3, 12, 8, 9, 4, 6, 10, 14, 1, 5, 2, 7, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{113,
+0x7dd72012c13efedcULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{114,
+0x7cc23710e031deceULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{115,
+0x0c0c6751e62d2ec4ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{116,
+0x0c018450e62d2ec4ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{117,
+0x94ecb41712fd08bdULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 14, 9, 4, 11, 7, 13, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{118,
+0x94e1841712fd08bdULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 14, 9, 4, 11, 7, 13, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{119,
+0x0c0c6751affd2ec4ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{120,
+0x0c018450affd2ec4ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{121,
+0xbe7f7a4dc3d82a0aULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{122,
+0x7cc0f010b8edfefeULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{123,
+0xbe7b5616d3f180e6ULL,
+0,
+1,
+{0, 3, 14, 12, 7, 5, 10, 8, 13, 4, 9, 2, 6, 1, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{124,
+0x7cc0f010e03dfefeULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{125,
+0xcdc5df8cb0bd0bb6ULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{126,
+0xc1c65610d1fff216ULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 11, 13, 8, 9, 4, 12, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{127,
+0xc1c65610d131e276ULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 11, 13, 8, 9, 4, 12, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{128,
+0xe1c27610d13df276ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{129,
+0xe1c27610d131e276ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{130,
+0xe1c23000ef31c246ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{131,
+0xe1c23000e321c246ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{132,
+0xe1c0f01089edfefaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{133,
+0xe1c0f010b8edfefaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{134,
+0x237f7a4d9b082a0eULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{135,
+0xe1c0f010d13dfefaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{136,
+0xe1c0f010e03dfefaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{137,
+0x5cc65610e031defeULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{138,
+0xe1c230002131e246ULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 11, 13, 8, 9, 4, 12, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{139,
+0xe1c23000e321c246ULL,
+0,
+1,
+{0, 14, 3, 10, 5, 7, 11, 13, 8, 9, 4, 12, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{140,
+0xe1c2761089edf276ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{141,
+0xe1c2761089e1e276ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{142,
+0xe1c23000b7e1c246ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{143,
+0xe1c23000bbf1c246ULL,
+0,
+1,
+{0, 12, 8, 14, 3, 5, 9, 11, 6, 13, 2, 10, 1, 4, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{144,
+0xbe7feb4d9b082a0aULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{145,
+0x7cc0b671ef31ceceULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{146,
+0xc77956cf1bf1d276ULL,
+0,
+1,
+{0, 13, 3, 10, 5, 7, 11, 12, 8, 9, 4, 14, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{147,
+0x0d7956cf1bf1d274ULL,
+0,
+1,
+{0, 13, 3, 10, 5, 7, 11, 12, 8, 9, 4, 14, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{148,
+0xe1c0b671b7ecf246ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 14, 9, 4, 11, 7, 13, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{149,
+0xe1c0b600b7ecf246ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 14, 9, 4, 11, 7, 13, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{150,
+0x0c7b3076ab01c244ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{151,
+0x0c7b3000bbf1c244ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{152,
+0xbe7f3206239180e6ULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{153,
+0xe1c0b600b7e1cecaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{154,
+0xe1c0b671b7e1cecaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{155,
+0x238eeb4d9b082a0eULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{156,
+0x237feb4d9b082a0eULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{157,
+0xe1c0b600ef31cecaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{158,
+0xe1c0b671ef31cecaULL,
+0,
+1,
+{0, 11, 6, 13, 8, 3, 14, 9, 4, 12, 7, 10, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{159,
+0x7cc23071e3d1ceceULL,
+0,
+1,
+{0, 13, 8, 5, 10, 12, 7, 14, 3, 4, 9, 6, 2, 11, 1},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{160,
+0x0c7b30a90b01c244ULL,
+0,
+1,
+{0, 13, 3, 10, 5, 7, 11, 12, 8, 9, 4, 14, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{161,
+0x0c7b30a90b01cc02ULL,
+0,
+1,
+{0, 13, 3, 10, 5, 7, 11, 12, 8, 9, 4, 14, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{162,
+0xe45920ad1b11b256ULL,
+0,
+1,
+{0, 13, 3, 9, 5, 7, 11, 12, 8, 14, 4, 10, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{163,
+0xe45920ad16e1b256ULL,
+0,
+1,
+{0, 13, 3, 9, 5, 7, 11, 12, 8, 14, 4, 10, 1, 6, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{164,
+0x0cc34076ab01c244ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{165,
+0x0cc34000bbf1c244ULL,
+0,
+1,
+{0, 10, 6, 12, 8, 3, 13, 9, 4, 11, 7, 14, 1, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{11,7,13},{1,11,13},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{166,
+0xe07a4000213cfa28ULL,
+0,
+1,
+{0, 12, 7, 10, 5, 14, 3, 4, 8, 9, 1, 11, 6, 13, 2},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{167,
+0x910240a90b01ca28ULL,
+32,
+4,
+{0, 11, 7, 13, 3, 5, 9, 10, 6, 12, 2, 14, 1, 4, 8},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{168,
+0xe6c240a90b01ca28ULL,
+0,
+1,
+{0, 3, 13, 11, 7, 5, 9, 2, 12, 4, 8, 10, 6, 1, 14},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{169,
+0xe6c240a90b01ca28ULL,
+0,
+1,
+{0, 5, 9, 11, 7, 13, 3, 1, 14, 12, 2, 4, 8, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{170,
+0x0ce240a90b01b46dULL,
+0,
+1,
+{0, 4, 8, 1, 14, 10, 6, 12, 2, 3, 13, 5, 9, 11, 7},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{171,
+0x3dc247cf1bf1da2aULL,
+0,
+1,
+{0, 10, 5, 14, 7, 3, 13, 8, 4, 11, 6, 9, 1, 2, 12},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{172,
+0x3dc240a90b01ca2aULL,
+0,
+1,
+{0, 10, 5, 14, 7, 3, 13, 8, 4, 11, 6, 9, 1, 2, 12},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{173,
+0xe07a47102131ea28ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 3, 14, 8, 4, 11, 6, 9, 1, 2, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{174,
+0xe07a40002131ea28ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 3, 14, 8, 4, 11, 6, 9, 1, 2, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{175,
+0xe6c24076ab01ca28ULL,
+0,
+1,
+{0, 11, 7, 5, 9, 3, 13, 14, 1, 4, 8, 12, 2, 10, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{176,
+0xe6c24076ab0d7d28ULL,
+36,
+2,
+{0, 11, 7, 5, 9, 3, 13, 14, 1, 4, 8, 12, 2, 10, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,9,13},{9,1,13},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{177,
+0x3b0e5251d6b3cdc6ULL,
+0,
+1,
+{0, 12, 3, 14, 7, 8, 4, 5, 9, 13, 1, 11, 2, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{178,
+0x0cd340a90b01ca3aULL,
+0,
+1,
+{0, 1, 14, 5, 9, 7, 11, 3, 13, 6, 10, 4, 8, 2, 12},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{179,
+0x0cd34076ab01ca3aULL,
+0,
+1,
+{0, 13, 3, 5, 9, 14, 1, 7, 11, 12, 2, 6, 10, 8, 4},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{180,
+0x2dc24811bbc1da18ULL,
+0,
+1,
+{0, 13, 3, 9, 5, 7, 11, 12, 2, 8, 4, 14, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{9,6,12},{3,9,12},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{181,
+0xe6c24076ab0d7d28ULL,
+0,
+1,
+{0, 13, 3, 12, 7, 9, 4, 6, 10, 14, 1, 5, 2, 8, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{182,
+0xe6c24076ab01ca28ULL,
+0,
+1,
+{0, 13, 3, 12, 7, 9, 4, 6, 10, 14, 1, 5, 2, 8, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{183,
+0xe07a40002131ea28ULL,
+0,
+1,
+{0, 14, 3, 9, 5, 7, 11, 13, 2, 8, 4, 12, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{184,
+0xe07a47102131ea28ULL,
+0,
+1,
+{0, 14, 3, 9, 5, 7, 11, 13, 2, 8, 4, 12, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{185,
+0xf6c12610bbf1da18ULL,
+0,
+1,
+{0, 10, 5, 14, 7, 3, 13, 8, 4, 11, 6, 9, 1, 2, 12},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{186,
+0xf07ca010d1fffa78ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 3, 14, 8, 4, 11, 6, 9, 1, 2, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{187,
+0xe078c671b7ecfa28ULL,
+0,
+1,
+{0, 14, 3, 12, 7, 9, 4, 6, 10, 13, 1, 5, 2, 8, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{188,
+0x3dc24076ab01ca2aULL,
+0,
+1,
+{0, 13, 3, 12, 7, 9, 4, 6, 10, 14, 1, 5, 2, 8, 11},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{189,
+0xe2585030e321ba38ULL,
+0,
+1,
+{0, 14, 3, 9, 5, 7, 11, 13, 2, 8, 4, 12, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{190,
+0xe25b40303131ea38ULL,
+0,
+1,
+{0, 14, 3, 9, 5, 7, 11, 13, 2, 8, 4, 12, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{191,
+0xe25b4030e321ba38ULL,
+0,
+1,
+{0, 14, 3, 9, 5, 7, 11, 13, 2, 8, 4, 12, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{192,
+0x3dc240a90b01ca2aULL,
+0,
+1,
+{0, 13, 3, 9, 5, 7, 11, 12, 2, 8, 4, 14, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{193,
+0x3dc247cf1bf1da2aULL,
+38,
+2,
+{0, 13, 3, 9, 5, 7, 11, 12, 2, 8, 4, 14, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{194,
+0xe259c630b6ebfa38ULL,
+0,
+1,
+{0, 7, 12, 6, 10, 8, 4, 3, 13, 14, 11, 1, 9, 2, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{195,
+0x3dc24076ab01ca2aULL,
+0,
+1,
+{0, 10, 5, 14, 7, 3, 13, 8, 4, 11, 6, 9, 1, 2, 12},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{196,
+0xe078c600213cfa28ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 3, 14, 8, 4, 11, 6, 9, 1, 2, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{197,
+0xe078c1102131ea28ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 3, 14, 8, 4, 11, 6, 9, 1, 2, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{198,
+0xe078c6002131ea28ULL,
+0,
+1,
+{0, 10, 5, 12, 7, 3, 14, 8, 4, 11, 6, 9, 1, 2, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{199,
+0x0ce162b93b1d036dULL,
+0,
+1,
+{0, 2, 12, 8, 4, 10, 6, 1, 14, 9, 5, 7, 11, 3, 13},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{200,
+0x0ce24076ab01ba3aULL,
+0,
+1,
+{0, 4, 8, 10, 6, 12, 2, 1, 14, 11, 7, 3, 13, 5, 9},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{201,
+0xe6c24710bbf1da28ULL,
+0,
+1,
+{0, 8, 4, 6, 10, 14, 1, 2, 12, 13, 3, 7, 11, 9, 5},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{202,
+0x0ce162b93b11ba3aULL,
+40,
+2,
+{0, 13, 3, 9, 5, 7, 11, 12, 2, 8, 4, 14, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,8,10},{8,0,10}}},
+
+{203,
+0x0ce162b93b11b46dULL,
+42,
+2,
+{0, 13, 3, 9, 5, 7, 11, 12, 2, 8, 4, 14, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{204,
+0x0ce162669b11ba3aULL,
+44,
+2,
+{0, 11, 7, 5, 9, 3, 13, 14, 1, 4, 8, 12, 2, 10, 6},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{205,
+0x0ce240a90b01b46dULL,
+0,
+1,
+{0, 13, 3, 9, 5, 7, 11, 12, 2, 8, 4, 14, 1, 6, 10},
+{{9,3,11},{1,9,11},{4,11,12},{11,3,12},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{206,
+0xc619be3253b08beaULL,
+0,
+1,
+{0, 12, 7, 13, 3, 4, 8, 10, 6, 5, 2, 9, 1, 11, 14},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{207,
+0xe2585030b6ebfa38ULL,
+0,
+1,
+{0, 12, 7, 13, 3, 4, 8, 10, 6, 5, 2, 9, 1, 11, 14},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,9,10},{9,5,10},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{208,
+0x7b2168043b1d0d3aULL,
+46,
+3,
+{0, 11, 7, 12, 3, 4, 8, 9, 6, 5, 2, 14, 1, 10, 13},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{209,
+0x3dc24076ab01ca2aULL,
+0,
+1,
+{0, 10, 6, 2, 12, 14, 1, 4, 8, 9, 5, 3, 13, 11, 7},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{210,
+0xe6c240ae1b01ca28ULL,
+0,
+1,
+{0, 8, 4, 6, 10, 14, 1, 2, 12, 13, 3, 7, 11, 9, 5},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{8,7,11},{4,8,11},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{211,
+0x7b2168043b1d0d3aULL,
+49,
+2,
+{0, 13, 3, 7, 11, 5, 9, 14, 1, 6, 10, 8, 4, 12, 2},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{10,5,13},{2,10,13},{2,0,10},{0,2,8}}},
+
+{212,
+0x3dc240a90b01ca2aULL,
+0,
+1,
+{0, 8, 4, 6, 10, 14, 1, 2, 12, 13, 3, 7, 11, 9, 5},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{8,4,12},{0,8,12},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{213,
+0x7b2168043b1d0d3aULL,
+51,
+2,
+{0, 4, 13, 11, 2, 1, 14, 9, 6, 5, 8, 10, 7, 3, 12},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,8,13},{8,2,13},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{214,
+0xe6c24076ab01ca28ULL,
+0,
+1,
+{0, 6, 10, 8, 4, 1, 14, 12, 2, 7, 11, 13, 3, 5, 9},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,10,12},{10,0,12},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{215,
+0x0ce162b93b11ba3aULL,
+0,
+1,
+{0, 6, 10, 8, 4, 1, 14, 12, 2, 7, 11, 13, 3, 5, 9},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,8,10},{8,0,10}}},
+
+{216,
+0xe6c240a90b01ca28ULL,
+0,
+1,
+{0, 6, 10, 8, 4, 1, 14, 12, 2, 7, 11, 13, 3, 5, 9},
+{{9,3,11},{1,9,11},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+{217,
+0x910240a90b01ca28ULL,
+0,
+1,
+{0, 14, 1, 12, 2, 10, 6, 8, 4, 11, 7, 13, 3, 9, 5},
+{{1,3,11},{3,1,9},{4,3,12},{3,4,11},{1,7,13},{7,1,11},{4,7,11},{7,4,8},{5,1,13},{1,5,9},{3,6,12},{6,3,9},{6,5,10},{5,6,9},{0,4,12},{4,0,8},{6,0,12},{0,6,10},{7,2,13},{2,7,8},{2,5,13},{5,2,10},{2,0,10},{0,2,8}}},
+
+};
+
+static const graphhash_t hash_index_bcc[218] = {
+	{0x0c018450affd2ec4ULL, 120},
+	{0x0c018450e62d2ec4ULL, 116},
+	{0x0c0c6751affd2ec4ULL, 119},
+	{0x0c0c6751e62d2ec4ULL, 115},
+	{0x0c0f2251e62d2358ULL, 100},
+	{0x0c0ff151e62d2358ULL,  99},
+	{0x0c6b30a90b9eac02ULL,  60},
+	{0x0c7b3000bbf1c244ULL, 151},
+	{0x0c7b3076ab01c244ULL, 150},
+	{0x0c7b30a90b01c244ULL, 160},
+	{0x0c7b30a90b01cc02ULL, 161},
+	{0x0cc34000bbf1c244ULL, 165},
+	{0x0cc34076ab01c244ULL, 164},
+	{0x0cd34076ab01ca3aULL, 179},
+	{0x0cd340a90b01ca3aULL, 178},
+	{0x0ce162669b11ba3aULL, 204},
+	{0x0ce162b93b11b46dULL, 203},
+	{0x0ce162b93b11ba3aULL, 202},
+	{0x0ce162b93b11ba3aULL, 215},
+	{0x0ce162b93b1d036dULL, 199},
+	{0x0ce24076ab01ba3aULL, 200},
+	{0x0ce240a90b01b46dULL, 170},
+	{0x0ce240a90b01b46dULL, 205},
+	{0x0d7956cf1bf1d274ULL, 147},
+	{0x15028177e2b448b8ULL,  63},
+	{0x15028407e2b448b8ULL,  65},
+	{0x15028b8ce2b448b8ULL,  66},
+	{0x15028efce2b448b8ULL,  64},
+	{0x19e18417126108b8ULL, 103},
+	{0x19e1841712fd08b8ULL, 111},
+	{0x19e18417afb548b8ULL,  89},
+	{0x19e18b9cafb548b8ULL,  90},
+	{0x19ecb41712fd08b8ULL, 107},
+	{0x19ecb417afb548b8ULL,  97},
+	{0x19ecbb9cafb548b8ULL,  98},
+	{0x237f7a4d9b082a0eULL, 134},
+	{0x237feb4d9b082a0eULL, 156},
+	{0x238eeb4d9b082a0eULL, 155},
+	{0x2dc24811bbc1da18ULL, 180},
+	{0x31018417affd08b8ULL,  83},
+	{0x31018450affd08b8ULL,  84},
+	{0x31018b9caffd08b8ULL,  78},
+	{0x31018bdbaffd08b8ULL,  79},
+	{0x310cb8d28fdde787ULL,  43},
+	{0x31c2888480dde787ULL,  41},
+	{0x380e64d7a9dcda4aULL,   0},
+	{0x38170a9101ddda4aULL,   6},
+	{0x38174fb103dcda4aULL,   4},
+	{0x38174fb1acdcda4aULL,   1},
+	{0x3b0e5251d6b3cdc6ULL, 177},
+	{0x3dc24076ab01ca2aULL, 188},
+	{0x3dc24076ab01ca2aULL, 195},
+	{0x3dc24076ab01ca2aULL, 209},
+	{0x3dc240a90b01ca2aULL, 172},
+	{0x3dc240a90b01ca2aULL, 192},
+	{0x3dc240a90b01ca2aULL, 212},
+	{0x3dc247cf1bf1da2aULL, 171},
+	{0x3dc247cf1bf1da2aULL, 193},
+	{0x41216fde8bb863aeULL,  42},
+	{0x41c26fde8bb863aeULL,  40},
+	{0x429df5d655718c91ULL,  93},
+	{0x429dfa5d55718c91ULL,  94},
+	{0x4dadfa5d55718c91ULL,  62},
+	{0x5cc65610e031defeULL, 137},
+	{0x5cc65613c13efeeeULL, 106},
+	{0x68f2899d33c08188ULL,  81},
+	{0x69753ddb8bb863b7ULL,  36},
+	{0x6975cb8023476eb7ULL,  37},
+	{0x69963ddb8bb863b7ULL,  38},
+	{0x69aaeb9023476eb7ULL,  39},
+	{0x6cf2775980934eccULL,  46},
+	{0x6cf2775983da3cacULL,  28},
+	{0x6dd03011e0aebeccULL,  53},
+	{0x6dd03011e3f6ccacULL,  52},
+	{0x6dd0301dc1a19edcULL,  49},
+	{0x6dd0301dc2f9ecbcULL,  51},
+	{0x729df5d655718c94ULL,  85},
+	{0x729dfa5d55718c94ULL,  86},
+	{0x7b2168043b1d0d3aULL, 208},
+	{0x7b2168043b1d0d3aULL, 211},
+	{0x7b2168043b1d0d3aULL, 213},
+	{0x7cc0b600ef31ceceULL,  88},
+	{0x7cc0b671ef31ceceULL, 145},
+	{0x7cc0f01089edfefeULL,  74},
+	{0x7cc0f010b8edfefeULL, 122},
+	{0x7cc0f010d13dfefeULL,  80},
+	{0x7cc0f010e03dfefeULL, 124},
+	{0x7cc23071e3d1ceceULL, 159},
+	{0x7cc23710e031deceULL, 114},
+	{0x7dc24610e0aebefeULL,  50},
+	{0x7dd72012c13efedcULL, 113},
+	{0x7dd7d010d13dfefdULL,  87},
+	{0x7fd23071e34eaedeULL,  59},
+	{0x7fd23410e0aebedeULL,  57},
+	{0x81018450affd0851ULL,  82},
+	{0x81018450affd0851ULL, 104},
+	{0x81018450affd2ec1ULL, 112},
+	{0x81018450e62d2ec1ULL, 110},
+	{0x81018bdbaffd0851ULL,  77},
+	{0x810c6751affd2ec1ULL, 108},
+	{0x810ff2598ffeaedeULL,  54},
+	{0x8cc7557e82d9190cULL,  20},
+	{0x8ce26ddf8bb863aeULL,  22},
+	{0x8db72c33c13efedcULL, 109},
+	{0x8dd62023c2f9ecbcULL,  45},
+	{0x8dd7d0d2991ffa8dULL,  73},
+	{0x8dd7d0d2c13efa8dULL,  76},
+	{0x8dd7d0d2c1cffa8dULL,  75},
+	{0x910240a90b01ca28ULL, 167},
+	{0x910240a90b01ca28ULL, 217},
+	{0x94e1841712fd08bdULL, 118},
+	{0x94ecb41712fd08bdULL, 117},
+	{0x959e4d17d0268c6eULL,  48},
+	{0x959e4d1dc0268c6eULL,  47},
+	{0x95e85d23c006bc6eULL,  44},
+	{0x9af73fb2e0d81ee9ULL,  16},
+	{0x9db72c33cedffdbcULL, 105},
+	{0xa4553fda8bb863b7ULL,  21},
+	{0xa455cb80c3376eb7ULL,  23},
+	{0xacb23acc00def12aULL,   8},
+	{0xacb23adf8cdfc33aULL,  31},
+	{0xacb29dcc00def12aULL,  14},
+	{0xacb29ddf8cdfc33aULL,  34},
+	{0xacf75aa101def12aULL,   2},
+	{0xacf75ac201def12aULL,  12},
+	{0xafadda4d55718c98ULL,  61},
+	{0xb43efa916e07d1a7ULL,   7},
+	{0xb510f8e0d317403fULL,  17},
+	{0xb51f219404def12aULL,  10},
+	{0xb51f21a05a16722fULL,  11},
+	{0xb53ebfb16e07d1a9ULL,   5},
+	{0xb55598da8cdfc33aULL,  29},
+	{0xb55598e0d337703fULL,  30},
+	{0xb555cb80c337703fULL,  32},
+	{0xbd6f3206330ee0e6ULL,  58},
+	{0xbd6f3416330ee0e6ULL,  56},
+	{0xbe7b5616d3f180e6ULL, 123},
+	{0xbe7f3206239180e6ULL, 152},
+	{0xbe7f7a4dc3d82a0aULL, 121},
+	{0xbe7feb4d9b082a0aULL, 144},
+	{0xbed1bd8d13bee0e6ULL,  55},
+	{0xc1c65610d131e276ULL, 127},
+	{0xc1c65610d1fff216ULL, 126},
+	{0xc5023ae75ed9d4a6ULL,   9},
+	{0xc5023af4d2d8e6b6ULL,  33},
+	{0xc502770ec1da1be6ULL,  27},
+	{0xc502788480dbe6b6ULL,  35},
+	{0xc50278970cdad4a6ULL,  15},
+	{0xc52623a9ee600d89ULL, 101},
+	{0xc5475aa16e07d1a7ULL,   3},
+	{0xc5475ae75ed9d6a7ULL,  13},
+	{0xc5475af4d2d8e4b7ULL,  19},
+	{0xc619be3253b08beaULL, 206},
+	{0xc7028177e2b44ab7ULL,  67},
+	{0xc7028407e2b44ab7ULL,  68},
+	{0xc7028b8ce2b44ab7ULL,  70},
+	{0xc7028efce2b44ab7ULL,  69},
+	{0xc77956cf1bf1d276ULL, 146},
+	{0xcdc5df88e2be0bb6ULL, 102},
+	{0xcdc5df8cb0bd0bb6ULL, 125},
+	{0xe078c1102131ea28ULL, 197},
+	{0xe078c6002131ea28ULL, 198},
+	{0xe078c600213cfa28ULL, 196},
+	{0xe078c671b7ecfa28ULL, 187},
+	{0xe07a40002131ea28ULL, 174},
+	{0xe07a40002131ea28ULL, 183},
+	{0xe07a4000213cfa28ULL, 166},
+	{0xe07a47102131ea28ULL, 173},
+	{0xe07a47102131ea28ULL, 184},
+	{0xe0d7d010d13dfef9ULL,  95},
+	{0xe0d7d010e03dfef9ULL,  96},
+	{0xe1c0b600b7e1cecaULL, 153},
+	{0xe1c0b600b7ecf246ULL, 149},
+	{0xe1c0b600ef31cecaULL, 157},
+	{0xe1c0b671b7e1cecaULL, 154},
+	{0xe1c0b671b7ecf246ULL, 148},
+	{0xe1c0b671ef31cecaULL, 158},
+	{0xe1c0f01089edfefaULL, 132},
+	{0xe1c0f010b8edfefaULL, 133},
+	{0xe1c0f010d13dfefaULL, 135},
+	{0xe1c0f010e03dfefaULL, 136},
+	{0xe1c230002131e246ULL, 138},
+	{0xe1c23000b7e1c246ULL, 142},
+	{0xe1c23000bbf1c246ULL, 143},
+	{0xe1c23000e321c246ULL, 131},
+	{0xe1c23000e321c246ULL, 139},
+	{0xe1c23000ef31c246ULL, 130},
+	{0xe1c2761089e1e276ULL, 141},
+	{0xe1c2761089edf276ULL, 140},
+	{0xe1c27610d131e276ULL, 129},
+	{0xe1c27610d13df276ULL, 128},
+	{0xe2585030b6ebfa38ULL, 207},
+	{0xe2585030e321ba38ULL, 189},
+	{0xe259c630b6ebfa38ULL, 194},
+	{0xe25b40303131ea38ULL, 190},
+	{0xe25b4030e321ba38ULL, 191},
+	{0xe45920ad16e1b256ULL, 163},
+	{0xe45920ad1b11b256ULL, 162},
+	{0xe67a591089e1e275ULL,  92},
+	{0xe67a5910bbf1d275ULL,  91},
+	{0xe6c24076ab01ca28ULL, 175},
+	{0xe6c24076ab01ca28ULL, 182},
+	{0xe6c24076ab01ca28ULL, 214},
+	{0xe6c24076ab0d7d28ULL, 176},
+	{0xe6c24076ab0d7d28ULL, 181},
+	{0xe6c240a90b01ca28ULL, 168},
+	{0xe6c240a90b01ca28ULL, 169},
+	{0xe6c240a90b01ca28ULL, 216},
+	{0xe6c240ae1b01ca28ULL, 210},
+	{0xe6c24710bbf1da28ULL, 201},
+	{0xebc63e99cf18efdcULL,  25},
+	{0xebe63c893d18efdcULL,  18},
+	{0xf07ca010d1fffa78ULL, 186},
+	{0xf3f27406a3fc2809ULL,  72},
+	{0xf3f27451a3fc2809ULL,  71},
+	{0xf6c12610bbf1da18ULL, 185},
+	{0xfbc63e99c3f9ecbcULL,  26},
+	{0xfce2888480dbe687ULL,  24},
+};
+
+static const uint64_t degree_sequences_bcc[70] = {
+	0x002c00000ULL,
+	0x003a10000ULL,
+	0x004820000ULL,
+	0x005630000ULL,
+	0x005711000ULL,
+	0x006440000ULL,
+	0x006602000ULL,
+	0x007331000ULL,
+	0x008060000ULL,
+	0x012920000ULL,
+	0x013730000ULL,
+	0x013811000ULL,
+	0x014540000ULL,
+	0x014621000ULL,
+	0x015350000ULL,
+	0x015431000ULL,
+	0x022640000ULL,
+	0x022721000ULL,
+	0x022802000ULL,
+	0x023450000ULL,
+	0x023531000ULL,
+	0x024260000ULL,
+	0x024341000ULL,
+	0x024422000ULL,
+	0x025151000ULL,
+	0x031631000ULL,
+	0x032360000ULL,
+	0x032441000ULL,
+	0x032522000ULL,
+	0x033251000ULL,
+	0x040622000ULL,
+	0x041432000ULL,
+	0x042080000ULL,
+	0x042161000ULL,
+	0x042242000ULL,
+	0x050342000ULL,
+	0x060062000ULL,
+	0x103640000ULL,
+	0x104450000ULL,
+	0x104531000ULL,
+	0x105341000ULL,
+	0x106232000ULL,
+	0x113360000ULL,
+	0x113441000ULL,
+	0x113522000ULL,
+	0x114251000ULL,
+	0x114332000ULL,
+	0x122432000ULL,
+	0x123161000ULL,
+	0x123242000ULL,
+	0x123323000ULL,
+	0x124052000ULL,
+	0x131342000ULL,
+	0x131423000ULL,
+	0x140414000ULL,
+	0x141062000ULL,
+	0x141143000ULL,
+	0x204080000ULL,
+	0x204242000ULL,
+	0x213233000ULL,
+	0x222062000ULL,
+	0x222143000ULL,
+	0x222224000ULL,
+	0x230324000ULL,
+	0x240044000ULL,
+	0x304034000ULL,
+	0x321044000ULL,
+	0x321125000ULL,
+	0x420026000ULL,
+	0x600008000ULL,
+};
+
+static const int32_t first_template_bcc[218] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 171, 172, 173, 174, 175, 176, 177, 178, 179, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 199, 200, 201, 202, 203, 204, 205, 206, 207, 209, 211, 213, 214, 215, 216, 219, 220, 221, 223, 224, 226, 227, 228, 229};
+
+static const permutedtemplate_t templates_bcc[230] = {
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{-1.082903768655,0,0},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 13, 10, 7, 11, 1, 9, 5, 12, 4, 2, 14, 6, 3, 8}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 14, 6, 11, 7, 13, 4, 5, 9, 8, 3, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 14, 6, 11, 7, 13, 4, 5, 9, 8, 3, 1}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 14, 6, 11, 7, 13, 4, 5, 9, 8, 3, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 14, 6, 11, 7, 13, 4, 5, 9, 8, 3, 1}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 14, 6, 11, 7, 13, 4, 5, 9, 8, 3, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 7, 1, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 9, 8, 14, 2, 10, 4, 13, 5, 1, 11, 3, 6, 7}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 9, 8, 14, 2, 10, 4, 13, 5, 1, 11, 3, 6, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 1, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 7, 1, 11, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 7, 1, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 9, 8, 14, 2, 10, 4, 13, 5, 1, 11, 3, 6, 7}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 7, 1, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 9, 8, 14, 2, 10, 4, 13, 5, 1, 11, 3, 6, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 9, 8, 3, 11, 6, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 9, 8, 14, 2, 10, 4, 13, 5, 1, 11, 3, 6, 7}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 7, 1, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 9, 8, 14, 2, 10, 4, 7, 11, 1, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 11, 7, 1, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 9, 8, 14, 2, 6, 7, 1, 3, 11}},
+{{{0,0,0},{0,0,1.082903768655},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 10, 14, 6, 7, 13, 4, 12, 2, 8, 9, 3, 11, 1, 5}},
+{{{0,0,0},{-1.082903768655,0,0},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 13, 10, 7, 1, 9, 5, 12, 4, 2, 14, 6, 11, 3, 8}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{-1.082903768655,0,0},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 13, 10, 7, 1, 9, 5, 12, 4, 2, 14, 6, 11, 3, 8}},
+{{{0,0,0},{-1.082903768655,0,0},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 13, 10, 7, 1, 9, 5, 12, 4, 2, 14, 6, 11, 3, 8}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 7, 1, 9, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 7, 1, 9, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{-1.082903768655,0,0},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 13, 12, 4, 7, 11, 1, 9, 5, 8, 14, 2, 10, 6, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,-1.082903768655,0},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 11, 10, 6, 3, 9, 1, 13, 7, 4, 12, 2, 14, 8, 5}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{-1.082903768655,0,0},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 13, 12, 4, 7, 11, 1, 9, 5, 8, 14, 2, 10, 6, 3}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 3, 11, 6, 10, 2, 4, 13, 5, 9, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 7, 1, 9, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 7, 1, 9, 3, 11}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{-1.082903768655,0,0},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 13, 10, 7, 1, 9, 5, 12, 4, 2, 6, 11, 3, 14, 8}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 13, 4, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 6, 11, 7, 13, 4, 5, 8, 14, 3, 9, 1}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 13, 4, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{0,0,1.082903768655},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 10, 11, 7, 13, 4, 12, 2, 6, 14, 3, 9, 1, 5, 8}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 13, 4, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 6, 11, 7, 13, 4, 5, 8, 14, 3, 9, 1}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 13, 4, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 11, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 11, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{-1.082903768655,0,0},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998}},
+{0, 13, 11, 1, 9, 5, 12, 4, 7, 10, 6, 14, 3, 8, 2}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 10, 4, 13, 5, 8, 14, 2, 6, 11, 7, 1, 9, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 7, 1, 11}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 7, 1, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 11, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 11, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 11, 1, 9, 3, 6}},
+{{{0,0,0},{1.082903768655,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 14, 12, 8, 9, 3, 11, 6, 2, 10, 4, 13, 5, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 7, 1, 11}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 9, 3, 6, 7, 1, 11}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 3, 11, 6, 7, 1, 9}},
+{{{0,0,0},{0,1.082903768655,0},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 12, 14, 2, 10, 4, 13, 5, 8, 3, 11, 6, 7, 1, 9}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 14, 2, 10, 4, 7, 1, 9, 3, 6, 11}},
+{{{0,0,0},{0,0,1.082903768655},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 10, 14, 6, 7, 4, 12, 2, 8, 9, 3, 11, 1, 13, 5}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 13, 5, 8, 2, 14, 6, 7, 1, 9, 3, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 1, 9, 3, 14, 6, 11}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 14, 2, 12, 5, 9, 3, 11, 6, 10, 4, 13, 1, 7}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0}},
+{0, 13, 7, 1, 9, 5, 12, 4, 10, 6, 11, 3, 8, 2, 14}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 7, 10, 6, 11, 1, 13, 4, 12, 2, 14, 3, 9, 5, 8}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998}},
+{0, 3, 8, 9, 1, 11, 6, 14, 2, 12, 5, 13, 7, 10, 4}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 14, 6, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 14, 6, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 3, 14, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 3, 14, 6}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 12, 5, 9, 3, 14, 2, 10, 4, 13, 1, 11, 6, 7}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 12, 5, 9, 3, 14, 2, 10, 4, 13, 1, 11, 6, 7}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 7, 1, 13, 4, 10, 6, 11, 3, 9, 5, 12, 2, 14, 8}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 6, 7, 13, 4, 5, 8, 14, 11, 1, 9, 3}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998}},
+{0, 1, 13, 7, 11, 3, 9, 5, 12, 4, 10, 6, 14, 8, 2}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 6, 10, 2, 14, 3, 11, 7, 13, 4, 12, 8, 9, 1, 5}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 4, 13, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 4, 13, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 14, 6, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 3, 14, 6}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 10, 12, 2, 6, 11, 7, 4, 13, 5, 8, 14, 3, 9, 1}},
+{{{0,0,0},{0,0,1.082903768655},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 10, 12, 2, 6, 11, 7, 4, 13, 5, 8, 14, 3, 1, 9}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 11, 7, 1}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 6, 7, 10, 2, 14, 3, 11, 1, 13, 4, 12, 8, 9, 5}},
+{{{0,0,0},{0,-1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655}},
+{0, 11, 13, 7, 6, 14, 3, 1, 5, 12, 4, 10, 2, 8, 9}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 14, 6, 3}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 3, 14, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 3, 14, 6}},
+{{{0,0,0},{0,1.082903768655,0},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 12, 13, 5, 8, 2, 10, 4, 7, 11, 1, 9, 3, 14, 6}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 7, 1, 13, 4, 10, 6, 11, 3, 9, 5, 12, 2, 14, 8}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 7, 6, 11, 1, 13, 4, 10, 2, 14, 3, 9, 5, 12, 8}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 6, 7, 10, 2, 14, 3, 11, 1, 13, 4, 12, 8, 9, 5}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 12, 5, 9, 3, 14, 2, 10, 4, 13, 1, 11, 6, 7}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998}},
+{0, 1, 7, 11, 3, 9, 5, 13, 4, 10, 6, 14, 8, 12, 2}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 12, 5, 9, 3, 14, 2, 10, 4, 13, 1, 11, 6, 7}},
+{{{0,0,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 7, 6, 11, 1, 13, 4, 10, 2, 14, 3, 9, 5, 12, 8}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 8, 2, 10, 4, 13, 5, 9, 3, 14, 6, 7, 1, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0}},
+{0, 12, 10, 4, 5, 9, 8, 2, 6, 11, 7, 13, 1, 3, 14}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0}},
+{0, 12, 10, 4, 5, 9, 8, 2, 6, 11, 7, 13, 1, 3, 14}},
+{{{0,0,0},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0,-1.082903768655,0}},
+{0, 12, 10, 4, 5, 9, 8, 2, 6, 7, 13, 1, 3, 14, 11}},
+{{{0,0,0},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 4, 5, 9, 8, 2, 10, 7, 13, 1, 3, 14, 6, 11}},
+{{{0,0,0},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0}},
+{0, 12, 2, 10, 4, 5, 9, 8, 14, 6, 7, 13, 1, 3, 11}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 6, 3, 11, 7, 10, 2, 14, 8, 9, 1, 13, 4, 12, 5}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 6, 7, 10, 2, 14, 3, 11, 1, 13, 4, 12, 8, 9, 5}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 14, 2, 12, 5, 9, 3, 11, 6, 10, 4, 13, 1, 7}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 8, 2, 12, 5, 9, 3, 14, 6, 10, 4, 13, 1, 11, 7}},
+{{{0,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998}},
+{0, 6, 7, 10, 2, 14, 3, 11, 1, 13, 4, 12, 8, 9, 5}},
+{{{0,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 5, 4, 13, 1, 9, 8, 12, 10, 7, 11, 3, 14, 2, 6}},
+{{{0,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 5, 12, 4, 13, 1, 9, 8, 2, 10, 7, 11, 3, 14, 6}},
+{{{0,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 5, 8, 12, 4, 13, 1, 9, 3, 14, 2, 10, 7, 11, 6}},
+{{{0,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 5, 8, 12, 4, 13, 1, 9, 3, 14, 2, 10, 7, 11, 6}},
+{{{0,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,1.082903768655,0},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,-1.082903768655,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998}},
+{0, 5, 8, 12, 4, 13, 1, 9, 3, 14, 2, 10, 7, 11, 6}},
+{{{0,0,0},{0.54145188432699998,0.54145188432699998,0.54145188432699998},{-0.54145188432699998,0.54145188432699998,0.54145188432699998},{0,1.082903768655,0},{0.54145188432699998,0.54145188432699998,-0.54145188432699998},{1.082903768655,0,0},{0.54145188432699998,-0.54145188432699998,0.54145188432699998},{0,0,1.082903768655},{-0.54145188432699998,-0.54145188432699998,0.54145188432699998},{-1.082903768655,0,0},{-0.54145188432699998,0.54145188432699998,-0.54145188432699998},{0,0,-1.082903768655},{0.54145188432699998,-0.54145188432699998,-0.54145188432699998},{0,-1.082903768655,0},{-0.54145188432699998,-0.54145188432699998,-0.54145188432699998}},
+{0, 2, 4, 12, 8, 14, 6, 10, 7, 13, 5, 9, 3, 11, 1}},
+};
+
+const graphtable_t graph_table_bcc = {218, graphs_bcc_canonical, hash_index_bcc, 70, degree_sequences_bcc, first_template_bcc, templates_bcc};
+
@@ -0,0 +1,42 @@
+#ifndef GRAPH_TABLES_HPP
+#define GRAPH_TABLES_HPP
+
+#include <cstdint>
+#include "graph_data.hpp"
+#include "index_ptm.h"
+
+//graph_tables.cpp is generated by generate_graph_tables (make graph_tables) from the reference graphs in graph_data.cpp
+
+typedef struct
+{
+	uint64_t hash;
+	int16_t graph;				//index into graphtable_t::graphs
+} graphhash_t;
+
+//The template points of a (reference graph, automorphism) pair, reordered by the canonical labelling of the graph.
+//An input hull with the same canonical form, reordered by its own labelling, then corresponds point for point.
+typedef struct
+{
+	double points[PTM_MAX_POINTS][3];
+	int8_t template_index[PTM_MAX_POINTS];	//template point of each canonical label
+} permutedtemplate_t;
+
+typedef struct
+{
+	int num_graphs;
+	const graph_t* graphs;			//facets oriented clockwise, with canonical labellings and hashes
+	const graphhash_t* hash_index;		//sorted by hash, then graph
+	int num_degree_sequences;
+	const uint64_t* degree_sequences;	//sorted keys from degree_sequence_key
+	const int32_t* first_template;		//index into templates of the first automorphism of each graph
+	const permutedtemplate_t* templates;	//every automorphism of every graph, in graph order
+} graphtable_t;
+
+extern const graphtable_t graph_table_sc;
+extern const graphtable_t graph_table_fcc;
+extern const graphtable_t graph_table_hcp;
+extern const graphtable_t graph_table_ico;
+extern const graphtable_t graph_table_bcc;
+
+#endif
+
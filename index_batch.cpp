@@ -0,0 +1,1268 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include "index_ptm.h"
+#include "index_batch.h"
+#include "numa_topology.hpp"
+#include "polar_decomposition.hpp"
+#include "orientation_sum.hpp"
+#include "qcprot/quat.hpp"
+
+
+#define MAX_BATCH_NBRS	18
+#define BLOCK_SIZE	256
+#define GRID_PARTIAL_MAX_BYTES	((size_t)1 << 30)	//default bound on the memory of the partial grids
+
+//bits of the output mask, one per requested output array
+#define OUTPUT_TYPE			(1 << 0)
+#define OUTPUT_ALLOY_TYPE		(1 << 1)
+#define OUTPUT_SCALE			(1 << 2)
+#define OUTPUT_RMSD			(1 << 3)
+#define OUTPUT_Q			(1 << 4)
+#define OUTPUT_F			(1 << 5)
+#define OUTPUT_F_RES			(1 << 6)
+#define OUTPUT_U			(1 << 7)
+#define OUTPUT_P			(1 << 8)
+#define OUTPUT_MAPPING			(1 << 9)
+#define OUTPUT_INTERATOMIC_DISTANCE	(1 << 10)
+#define OUTPUT_LATTICE_CONSTANT		(1 << 11)
+#define OUTPUT_KAM			(1 << 12)
+#define OUTPUT_VON_MISES_STRAIN		(1 << 13)
+#define OUTPUT_VOLUMETRIC_STRAIN	(1 << 14)
+#define OUTPUT_GREEN_LAGRANGE		(1 << 15)
+#define OUTPUT_GRID			(1 << 16)
+
+static_assert(NUMA_MAX_NODES <= PTM_BATCH_MAX_NODES, "too many NUMA nodes for the batch statistics");
+
+//the per-atom values summarized in ptm_batch_stats_t and the grid outputs
+typedef struct
+{
+	int32_t type;
+	int32_t alloy_type;
+	double rmsd;
+	double scale;
+	double lattice_constant;
+	double q[4];
+} summaryrecord_t;
+
+//per-thread accumulators for ptm_batch_stats_t, merged when the workers have finished
+typedef struct
+{
+	int64_t structure_counts[PTM_MATCH_SC + 1];
+	int64_t alloy_counts[PTM_ALLOY_B2 + 1];
+	int64_t histograms[3][PTM_MATCH_SC + 1][PTM_BATCH_HISTOGRAM_BINS];	//rmsd, scale and lattice constant
+} batchsummary_t;
+
+//partial sums of the grid outputs, each shared by a contiguous group of threads
+typedef struct
+{
+	std::vector<int64_t> counts;			//PTM_MATCH_SC + 1 per voxel
+	std::vector<double> rmsd;			//sums over the matched atoms
+	std::vector<double> lattice_constant;
+	std::vector<orientationsum_t> orientation;
+} gridpartial_t;
+
+struct ptm_batch
+{
+	int num_threads;
+	std::vector<ptm_local_handle_t> local_handles;
+	std::vector< std::vector<int> > node_cpus;
+
+	//the per-atom state below is only valid for this configuration
+	int num_atoms;
+	int num_nbrs;
+	int32_t flags;
+	bool topological_ordering;
+	uint32_t output_mask;
+	bool summarize;
+
+	//Per-atom buffers are allocated with malloc and initialized block by block by the workers,
+	//so that on NUMA systems each page is first touched, and therefore placed, on the node which uses it.
+	uint8_t* valid;				//output arrays hold a result for this atom
+	double* reference;			//neighbour vectors when the atom was last indexed
+	int32_t* reference_numbers;		//species of the atom and its neighbours when it was last indexed (0 if none were given)
+	int32_t* prev_type;
+	int8_t* prev_mapping;
+	int32_t* prev_nbrs;			//input indices of the neighbours that prev_mapping refers to
+
+	summaryrecord_t* summary_record;	//summarized and gridded values of each atom, kept for atoms which are skipped
+
+	//orientations for the KAM sweep, kept here when they are not requested as outputs
+	int32_t* kam_type;
+	double* kam_q;
+	int8_t* kam_mapping;
+
+	//spatially ordered copies of the inputs
+	std::vector<int32_t> order;		//input index of the atom at each ordered position
+	std::vector<int32_t> rank;		//ordered position of each input atom
+	int ordered_num_atoms;			//size of the buffers below
+	int ordered_num_nbrs;
+	double* ordered_positions;
+	int32_t* ordered_numbers;
+	int32_t* ordered_nbrs;
+};
+
+typedef struct
+{
+	ptm_batch_handle_t handle;
+	const ptm_batch_config_t* config;
+	int num_atoms;
+	double* positions;
+	int32_t* numbers;
+	int num_nbrs;
+	int nbr_stride;
+	int32_t* nbrs;
+	int32_t* order;				//input index of each atom, or NULL if the inputs are not reordered
+	ptm_batch_output_t* output;
+
+	//unordered inputs, copied into the ordered buffers block by block
+	double* input_positions;
+	int32_t* input_numbers;
+	int input_stride;
+	int32_t* input_nbrs;
+
+	bool init_skip;				//per-atom state was just allocated and must be initialized
+	bool init_warm;
+
+	//atoms are partitioned between NUMA nodes in contiguous ranges of blocks
+	int num_threads;
+	int num_nodes;
+	bool pin_threads;
+	int block_begin[PTM_BATCH_MAX_NODES];
+	int block_end[PTM_BATCH_MAX_NODES];
+	std::atomic<int> next_block[PTM_BATCH_MAX_NODES];
+	std::atomic<int> next_copy_block[PTM_BATCH_MAX_NODES];
+	std::atomic<int> next_kam_block[PTM_BATCH_MAX_NODES];
+	std::atomic<int64_t> node_num_atoms[PTM_BATCH_MAX_NODES];
+	std::vector<double> thread_time;
+	std::vector<batchsummary_t> thread_summary;	//empty unless summarizing
+	std::vector<gridpartial_t> grid_partials;	//empty unless there is a grid output
+	std::unique_ptr<std::mutex[]> grid_locks;	//one per partial grid
+
+	std::atomic<int64_t> num_skipped;
+} batchjob_t;
+
+template <typename T> static void reallocate(T** p, size_t n)
+{
+	free(*p);
+	*p = (T*)malloc(n * sizeof(T));
+}
+
+//threads are assigned to nodes in contiguous groups, and each node indexes a share of the blocks proportional to its threads
+static int thread_node(int thread, int num_threads, int num_nodes)
+{
+	return (int)((int64_t)thread * num_nodes / num_threads);
+}
+
+static int node_first_thread(int node, int num_threads, int num_nodes)
+{
+	return (int)(((int64_t)node * num_threads + num_nodes - 1) / num_nodes);
+}
+
+static void node_blocks(int node, int num_threads, int num_nodes, int num_blocks, int* p_begin, int* p_end)
+{
+	*p_begin = (int)((int64_t)num_blocks * node_first_thread(node, num_threads, num_nodes) / num_threads);
+	*p_end = (int)((int64_t)num_blocks * node_first_thread(node + 1, num_threads, num_nodes) / num_threads);
+}
+
+static int num_blocks(int num_atoms)
+{
+	return (num_atoms + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+static int num_worker_threads(ptm_batch_handle_t handle, int num_atoms)
+{
+	return std::max(1, std::min(handle->num_threads, num_blocks(num_atoms)));
+}
+
+static int num_worker_nodes(ptm_batch_handle_t handle, bool numa_aware, int num_threads)
+{
+	return numa_aware ? std::min((int)handle->node_cpus.size(), num_threads) : 1;
+}
+
+static uint32_t get_output_mask(ptm_batch_output_t* output)
+{
+	uint32_t mask = 0;
+	if (output->type != NULL)			mask |= OUTPUT_TYPE;
+	if (output->alloy_type != NULL)			mask |= OUTPUT_ALLOY_TYPE;
+	if (output->scale != NULL)			mask |= OUTPUT_SCALE;
+	if (output->rmsd != NULL)			mask |= OUTPUT_RMSD;
+	if (output->q != NULL)				mask |= OUTPUT_Q;
+	if (output->F != NULL)				mask |= OUTPUT_F;
+	if (output->F_res != NULL)			mask |= OUTPUT_F_RES;
+	if (output->U != NULL)				mask |= OUTPUT_U;
+	if (output->P != NULL)				mask |= OUTPUT_P;
+	if (output->mapping != NULL)			mask |= OUTPUT_MAPPING;
+	if (output->interatomic_distance != NULL)	mask |= OUTPUT_INTERATOMIC_DISTANCE;
+	if (output->lattice_constant != NULL)		mask |= OUTPUT_LATTICE_CONSTANT;
+	if (output->kam != NULL)			mask |= OUTPUT_KAM;
+	if (output->von_mises_strain != NULL)		mask |= OUTPUT_VON_MISES_STRAIN;
+	if (output->volumetric_strain != NULL)		mask |= OUTPUT_VOLUMETRIC_STRAIN;
+	if (output->green_lagrange != NULL)		mask |= OUTPUT_GREEN_LAGRANGE;
+	if (output->grid != NULL)			mask |= OUTPUT_GRID;
+	return mask;
+}
+
+static bool neighbourhood_unchanged(int num_nbrs, double (*points)[3], int32_t* numbers, double* reference, int32_t* reference_numbers, double tolerance)
+{
+	if (memcmp(numbers, reference_numbers, (num_nbrs + 1) * sizeof(int32_t)) != 0)
+		return false;
+
+	double tolsq = tolerance * tolerance;
+	for (int k=0;k<num_nbrs;k++)
+	{
+		double dx = points[k+1][0] - reference[3 * k + 0];
+		double dy = points[k+1][1] - reference[3 * k + 1];
+		double dz = points[k+1][2] - reference[3 * k + 2];
+		if (dx*dx + dy*dy + dz*dz >= tolsq)
+			return false;
+	}
+
+	return true;
+}
+
+static uint32_t spread_bits(uint32_t x)
+{
+	x &= 0x3ff;
+	x = (x | (x << 16)) & 0x030000ff;
+	x = (x | (x <<  8)) & 0x0300f00f;
+	x = (x | (x <<  4)) & 0x030c30c3;
+	x = (x | (x <<  2)) & 0x09249249;
+	return x;
+}
+
+//sorts atoms along a Z-order (Morton) curve with 10 bits per dimension
+static void spatial_order(int num_atoms, double* positions, double* box, std::vector<int32_t>& order)
+{
+	double lo[3] = {0, 0, 0}, length[3];
+	for (int j=0;j<3;j++)
+	{
+		if (box != NULL)
+		{
+			length[j] = box[j];
+		}
+		else
+		{
+			double dmin = DBL_MAX, dmax = -DBL_MAX;
+			for (int i=0;i<num_atoms;i++)
+			{
+				dmin = std::min(dmin, positions[3 * i + j]);
+				dmax = std::max(dmax, positions[3 * i + j]);
+			}
+
+			lo[j] = dmin;
+			length[j] = std::max(dmax - dmin, DBL_MIN);
+		}
+	}
+
+	std::vector<uint64_t> keys(num_atoms);
+	for (int i=0;i<num_atoms;i++)
+	{
+		uint32_t code = 0;
+		for (int j=0;j<3;j++)
+		{
+			double f = (positions[3 * i + j] - lo[j]) / length[j];
+			if (box != NULL)
+				f -= floor(f);
+
+			uint32_t c = (uint32_t)std::min(1023.0, std::max(0.0, f * 1024));
+			code |= spread_bits(c) << j;
+		}
+
+		keys[i] = ((uint64_t)code << 32) | (uint32_t)i;
+	}
+
+	std::sort(keys.begin(), keys.end());
+
+	order.resize(num_atoms);
+	for (int i=0;i<num_atoms;i++)
+		order[i] = (int32_t)(keys[i] & 0xffffffff);
+}
+
+//the ordered copies themselves are made by the workers, in copy_ordered_block
+static void prepare_ordering(ptm_batch_handle_t handle, int num_atoms, double* positions, double* box, int num_nbrs)
+{
+	spatial_order(num_atoms, positions, box, handle->order);
+
+	handle->rank.resize(num_atoms);
+	for (int i=0;i<num_atoms;i++)
+		handle->rank[handle->order[i]] = i;
+
+	if (handle->ordered_num_atoms != num_atoms || handle->ordered_num_nbrs != num_nbrs)
+	{
+		reallocate(&handle->ordered_positions, 3 * (size_t)num_atoms);
+		reallocate(&handle->ordered_numbers, num_atoms);
+		reallocate(&handle->ordered_nbrs, (size_t)num_atoms * num_nbrs);
+		handle->ordered_num_atoms = num_atoms;
+		handle->ordered_num_nbrs = num_nbrs;
+	}
+}
+
+static void copy_ordered_block(batchjob_t* job, int start, int end)
+{
+	ptm_batch_handle_t handle = job->handle;
+	int num_nbrs = job->num_nbrs;
+	for (int i=start;i<end;i++)
+	{
+		int index = job->order[i];
+		memcpy(&handle->ordered_positions[3 * (size_t)i], &job->input_positions[3 * (size_t)index], 3 * sizeof(double));
+		for (int k=0;k<num_nbrs;k++)
+			handle->ordered_nbrs[(size_t)i * num_nbrs + k] = handle->rank[job->input_nbrs[(size_t)index * job->input_stride + k]];
+
+		if (job->input_numbers != NULL)
+			handle->ordered_numbers[i] = job->input_numbers[index];
+	}
+}
+
+//per-atom state is stored by input index, so it is placed by input index too
+static void initialize_state_block(batchjob_t* job, int start, int end)
+{
+	ptm_batch_handle_t handle = job->handle;
+	if (job->init_skip)
+	{
+		memset(&handle->valid[start], 0, (end - start) * sizeof(uint8_t));
+		memset(&handle->reference[(size_t)start * job->num_nbrs * 3], 0, (size_t)(end - start) * job->num_nbrs * 3 * sizeof(double));
+		memset(&handle->reference_numbers[(size_t)start * (job->num_nbrs + 1)], 0, (size_t)(end - start) * (job->num_nbrs + 1) * sizeof(int32_t));
+	}
+
+	if (job->init_warm)
+	{
+		for (int i=start;i<end;i++)
+			handle->prev_type[i] = PTM_MATCH_NONE;
+		memset(&handle->prev_mapping[(size_t)start * PTM_MAX_POINTS], -1, (size_t)(end - start) * PTM_MAX_POINTS * sizeof(int8_t));
+		memset(&handle->prev_nbrs[(size_t)start * job->num_nbrs], -1, (size_t)(end - start) * job->num_nbrs * sizeof(int32_t));
+	}
+}
+
+//deformation gradients of a block, held back so that their polar decompositions can be calculated together
+typedef struct
+{
+	int num;
+	int atom[BLOCK_SIZE];
+	double ratio[BLOCK_SIZE];
+	double F[BLOCK_SIZE][9];
+	double U[BLOCK_SIZE][9];
+	double P[BLOCK_SIZE][9];
+} polarblock_t;
+
+//F and P map the ideal template, scaled to the atom's own interatomic distance, onto the neighbourhood.  Relative to a lattice
+//with lattice constant a_ref they are multiplied by lattice_constant / a_ref.
+static double von_mises_strain(double ratio, double* P)
+{
+	double S[9];
+	for (int j=0;j<9;j++)
+		S[j] = ratio * P[j] - (j % 4 == 0 ? 1 : 0);
+
+	double t = (S[0] - S[4]) * (S[0] - S[4]) + (S[4] - S[8]) * (S[4] - S[8]) + (S[8] - S[0]) * (S[8] - S[0]);
+	t += 6 * (S[5] * S[5] + S[6] * S[6] + S[1] * S[1]);
+	return sqrt(t / 2);
+}
+
+static void calculate_strains(ptm_batch_output_t* output, size_t atom, double ratio, double* F)
+{
+	if (output->volumetric_strain != NULL)
+	{
+		double det = F[0] * (F[4] * F[8] - F[5] * F[7])
+			   - F[1] * (F[3] * F[8] - F[5] * F[6])
+			   + F[2] * (F[3] * F[7] - F[4] * F[6]);
+		output->volumetric_strain[atom] = ratio * ratio * ratio * det - 1;
+	}
+
+	if (output->green_lagrange != NULL)
+	{
+		double* E = &output->green_lagrange[9 * atom];
+		for (int j=0;j<3;j++)
+			for (int k=0;k<3;k++)
+			{
+				double c = 0;
+				for (int l=0;l<3;l++)
+					c += F[3 * l + j] * F[3 * l + k];
+				E[3 * j + k] = (ratio * ratio * c - (j == k ? 1 : 0)) / 2;
+			}
+	}
+}
+
+static void add_to_histogram(const double* range, int64_t* counts, double value)
+{
+	if (!(range[1] > range[0]))
+		return;
+
+	double f = (value - range[0]) / (range[1] - range[0]) * PTM_BATCH_HISTOGRAM_BINS;
+	int bin = f < 0 ? 0 : (f >= PTM_BATCH_HISTOGRAM_BINS - 1 ? PTM_BATCH_HISTOGRAM_BINS - 1 : (int)f);
+	counts[bin]++;
+}
+
+static void summarize_atom(const ptm_batch_config_t* config, batchsummary_t* summary, const summaryrecord_t* r)
+{
+	summary->structure_counts[r->type]++;
+	summary->alloy_counts[r->alloy_type]++;
+	if (r->type == PTM_MATCH_NONE)
+		return;
+
+	add_to_histogram(config->rmsd_range, summary->histograms[0][r->type], r->rmsd);
+	add_to_histogram(config->scale_range, summary->histograms[1][r->type], r->scale);
+	add_to_histogram(config->lattice_constant_range, summary->histograms[2][r->type], r->lattice_constant);
+}
+
+static int64_t num_voxels(const ptm_batch_grid_t* grid)
+{
+	return (int64_t)grid->dims[0] * grid->dims[1] * grid->dims[2];
+}
+
+//bytes of a partial grid per voxel
+static size_t grid_partial_bytes(const ptm_batch_grid_t* grid)
+{
+	size_t bytes = (PTM_MATCH_SC + 1) * sizeof(int64_t);
+	if (grid->mean_rmsd != NULL)			bytes += sizeof(double);
+	if (grid->mean_lattice_constant != NULL)	bytes += sizeof(double);
+	if (grid->orientation != NULL)			bytes += sizeof(orientationsum_t);
+	return bytes;
+}
+
+//one partial grid per thread, or fewer if that would exceed the memory bound
+static int num_grid_partials(const ptm_batch_grid_t* grid, int num_threads)
+{
+	size_t max_bytes = grid->max_partial_bytes > 0 ? grid->max_partial_bytes : GRID_PARTIAL_MAX_BYTES;
+	size_t bytes = (size_t)num_voxels(grid) * grid_partial_bytes(grid);
+	size_t num = max_bytes / std::max(bytes, (size_t)1);
+	return (int)std::max((size_t)1, std::min(num, (size_t)num_threads));
+}
+
+static void initialize_grid_partial(const ptm_batch_grid_t* grid, gridpartial_t* partial)
+{
+	int64_t n = num_voxels(grid);
+	partial->counts.assign(n * (PTM_MATCH_SC + 1), 0);
+	if (grid->mean_rmsd != NULL)
+		partial->rmsd.assign(n, 0);
+	if (grid->mean_lattice_constant != NULL)
+		partial->lattice_constant.assign(n, 0);
+	if (grid->orientation != NULL)
+	{
+		orientationsum_t empty;
+		memset(&empty, 0, sizeof(orientationsum_t));
+		partial->orientation.assign(n, empty);
+	}
+}
+
+//grid records of a block, held back so that a shared partial grid is locked once per block
+typedef struct
+{
+	int num;
+	int64_t voxel[BLOCK_SIZE];
+	summaryrecord_t record[BLOCK_SIZE];
+} gridblock_t;
+
+static void grid_atom(batchjob_t* job, gridblock_t* grid_block, int i, const summaryrecord_t* r)
+{
+	const ptm_batch_grid_t* grid = job->output->grid;
+	const double* box = job->config->box;
+
+	int64_t voxel = 0;
+	for (int j=2;j>=0;j--)
+	{
+		double x = job->positions[3 * (size_t)i + j];
+		if (box != NULL)
+			x -= box[j] * floor(x / box[j]);
+
+		double f = floor((x - grid->origin[j]) / grid->voxel_size[j]);
+		if (!(f >= 0 && f < grid->dims[j]))
+			return;
+		voxel = voxel * grid->dims[j] + (int64_t)f;
+	}
+
+	grid_block->voxel[grid_block->num] = voxel;
+	grid_block->record[grid_block->num] = *r;
+	grid_block->num++;
+}
+
+static void flush_grid_block(batchjob_t* job, int thread, gridblock_t* grid_block)
+{
+	const ptm_batch_grid_t* grid = job->output->grid;
+	int p = (int)((int64_t)thread * job->grid_partials.size() / job->num_threads);
+	gridpartial_t* partial = &job->grid_partials[p];
+
+	std::lock_guard<std::mutex> lock(job->grid_locks[p]);
+	if (partial->counts.size() == 0)
+		initialize_grid_partial(grid, partial);
+
+	for (int k=0;k<grid_block->num;k++)
+	{
+		int64_t voxel = grid_block->voxel[k];
+		const summaryrecord_t* r = &grid_block->record[k];
+		partial->counts[voxel * (PTM_MATCH_SC + 1) + r->type]++;
+		if (r->type == PTM_MATCH_NONE)
+			continue;
+
+		if (grid->mean_rmsd != NULL)			partial->rmsd[voxel] += r->rmsd;
+		if (grid->mean_lattice_constant != NULL)	partial->lattice_constant[voxel] += r->lattice_constant;
+		if (grid->orientation != NULL && r->type == grid->orientation_type)
+			orientation_sum_add(&partial->orientation[voxel], r->type, r->q);
+	}
+	grid_block->num = 0;
+}
+
+//i indexes the (possibly reordered) inputs; outputs and per-atom state are stored by input index.
+//Returns true if the stored result of the atom was reused.
+static bool index_atom(ptm_local_handle_t local_handle, batchjob_t* job, int i, polarblock_t* polar_block, batchsummary_t* summary, gridblock_t* grid)
+{
+	ptm_batch_handle_t handle = job->handle;
+	const ptm_batch_config_t* config = job->config;
+	ptm_batch_output_t* output = job->output;
+	int num_nbrs = job->num_nbrs;
+	int num_points = num_nbrs + 1;
+
+	//gather neighbour vectors relative to the central atom
+	double points[MAX_BATCH_NBRS + 1][3];
+	int32_t numbers[MAX_BATCH_NBRS + 1];
+	double* x0 = &job->positions[3 * i];
+	double* box = config->box;
+	points[0][0] = points[0][1] = points[0][2] = 0;
+	for (int k=0;k<num_nbrs;k++)
+	{
+		int index = job->nbrs[(size_t)i * job->nbr_stride + k];
+		double* x = &job->positions[3 * index];
+		for (int j=0;j<3;j++)
+		{
+			double delta = x[j] - x0[j];
+			if (box != NULL)
+				delta -= box[j] * round(delta / box[j]);
+			points[k+1][j] = delta;
+		}
+	}
+
+	if (job->numbers != NULL)
+	{
+		numbers[0] = job->numbers[i];
+		for (int k=0;k<num_nbrs;k++)
+			numbers[k+1] = job->numbers[job->nbrs[(size_t)i * job->nbr_stride + k]];
+	}
+	else
+	{
+		memset(numbers, 0, num_points * sizeof(int32_t));
+	}
+
+	int atom = job->order != NULL ? job->order[i] : i;
+
+	double* reference = NULL;
+	int32_t* reference_numbers = NULL;
+	if (config->skip_tolerance > 0)
+	{
+		reference = &handle->reference[(size_t)atom * num_nbrs * 3];
+		reference_numbers = &handle->reference_numbers[(size_t)atom * num_points];
+		if (handle->valid[atom] && neighbourhood_unchanged(num_nbrs, points, numbers, reference, reference_numbers, config->skip_tolerance))
+		{
+			if (summary != NULL)
+				summarize_atom(config, summary, &handle->summary_record[atom]);
+			if (grid != NULL)
+				grid_atom(job, grid, i, &handle->summary_record[atom]);
+			return true;
+		}
+	}
+
+	int32_t type, alloy_type = PTM_ALLOY_NONE;
+	double scale, rmsd, interatomic_distance = 0, lattice_constant = 0;
+	double q[4], F[9], F_res[3];
+	int8_t mapping[PTM_MAX_POINTS];
+
+	uint32_t mask = handle->output_mask;
+	uint32_t strain_mask = OUTPUT_VON_MISES_STRAIN | OUTPUT_VOLUMETRIC_STRAIN | OUTPUT_GREEN_LAGRANGE;
+	bool strains = mask & (OUTPUT_F | OUTPUT_F_RES | OUTPUT_U | OUTPUT_P | strain_mask);
+	bool polar = mask & (OUTPUT_U | OUTPUT_P | OUTPUT_VON_MISES_STRAIN);
+
+	if (config->warm_start_rmsd > 0)
+	{
+		int8_t* prev_mapping = &handle->prev_mapping[(size_t)atom * PTM_MAX_POINTS];
+		int32_t* prev_nbrs = &handle->prev_nbrs[(size_t)atom * num_nbrs];
+
+		//neighbours are identified by input index, since the ordered indices change when the atoms are reordered
+		int32_t nbr_ids[MAX_BATCH_NBRS];
+		for (int k=0;k<num_nbrs;k++)
+		{
+			int index = job->nbrs[(size_t)i * job->nbr_stride + k];
+			nbr_ids[k] = job->order != NULL ? job->order[index] : index;
+		}
+
+		ptm_index_warm_start(	local_handle, num_points, points[0], job->numbers != NULL ? numbers : NULL, config->flags, config->topological_ordering,
+					handle->prev_type[atom], prev_mapping, prev_nbrs, nbr_ids, config->warm_start_rmsd,
+					&type, &alloy_type, &scale, &rmsd, q, strains ? F : NULL, strains ? F_res : NULL, NULL, NULL, mapping, &interatomic_distance, &lattice_constant);
+
+		handle->prev_type[atom] = type;
+		memcpy(prev_mapping, mapping, PTM_MAX_POINTS * sizeof(int8_t));
+		memcpy(prev_nbrs, nbr_ids, num_nbrs * sizeof(int32_t));
+	}
+	else
+	{
+		ptm_index(	local_handle, num_points, points[0], job->numbers != NULL ? numbers : NULL, config->flags, config->topological_ordering,
+				&type, &alloy_type, &scale, &rmsd, q, strains ? F : NULL, strains ? F_res : NULL, NULL, NULL, mapping, &interatomic_distance, &lattice_constant);
+	}
+
+	if (output->type != NULL)			output->type[atom] = type;
+	if (output->alloy_type != NULL)			output->alloy_type[atom] = alloy_type;
+	if (output->scale != NULL)			output->scale[atom] = scale;
+	if (output->rmsd != NULL)			output->rmsd[atom] = rmsd;
+	if (output->q != NULL)				memcpy(&output->q[4 * (size_t)atom], q, 4 * sizeof(double));
+	if (output->F != NULL)				memcpy(&output->F[9 * (size_t)atom], F, 9 * sizeof(double));
+	if (output->F_res != NULL)			memcpy(&output->F_res[3 * (size_t)atom], F_res, 3 * sizeof(double));
+	if (output->mapping != NULL)			memcpy(&output->mapping[PTM_MAX_POINTS * (size_t)atom], mapping, PTM_MAX_POINTS * sizeof(int8_t));
+	if (output->interatomic_distance != NULL)	output->interatomic_distance[atom] = interatomic_distance;
+	if (output->lattice_constant != NULL)		output->lattice_constant[atom] = lattice_constant;
+
+	if ((mask & strain_mask) || polar)
+	{
+		if (type == PTM_MATCH_NONE)
+		{
+			if (output->U != NULL)			memset(&output->U[9 * (size_t)atom], 0, 9 * sizeof(double));
+			if (output->P != NULL)			memset(&output->P[9 * (size_t)atom], 0, 9 * sizeof(double));
+			if (output->von_mises_strain != NULL)	output->von_mises_strain[atom] = 0;
+			if (output->volumetric_strain != NULL)	output->volumetric_strain[atom] = 0;
+			if (output->green_lagrange != NULL)	memset(&output->green_lagrange[9 * (size_t)atom], 0, 9 * sizeof(double));
+		}
+		else
+		{
+			double a_ref = config->reference_lattice_constant[type];
+			double ratio = a_ref > 0 ? lattice_constant / a_ref : 1;
+			calculate_strains(output, atom, ratio, F);
+
+			//U, P and the von Mises strain are written by decompose_block
+			if (polar)
+			{
+				int k = polar_block->num++;
+				polar_block->atom[k] = atom;
+				polar_block->ratio[k] = ratio;
+				memcpy(polar_block->F[k], F, 9 * sizeof(double));
+			}
+		}
+	}
+
+	if (summary != NULL || grid != NULL)
+	{
+		summaryrecord_t record = {type, alloy_type, rmsd, scale, lattice_constant, {q[0], q[1], q[2], q[3]}};
+		if (summary != NULL)
+			summarize_atom(config, summary, &record);
+		if (grid != NULL)
+			grid_atom(job, grid, i, &record);
+		if (handle->summary_record != NULL)
+			handle->summary_record[atom] = record;
+	}
+
+	if (handle->kam_type != NULL)			handle->kam_type[atom] = type;
+	if (handle->kam_q != NULL)			memcpy(&handle->kam_q[4 * (size_t)atom], q, 4 * sizeof(double));
+	if (handle->kam_mapping != NULL)		memcpy(&handle->kam_mapping[PTM_MAX_POINTS * (size_t)atom], mapping, PTM_MAX_POINTS * sizeof(int8_t));
+
+	if (reference != NULL)
+	{
+		memcpy(reference, points[1], num_nbrs * 3 * sizeof(double));
+		memcpy(reference_numbers, numbers, num_points * sizeof(int32_t));
+		handle->valid[atom] = 1;
+	}
+
+	return false;
+}
+
+static void decompose_block(batchjob_t* job, polarblock_t* b)
+{
+	ptm_batch_output_t* output = job->output;
+	polar_decompositions_3x3(b->num, b->F[0], false, b->U[0], b->P[0]);
+
+	for (int k=0;k<b->num;k++)
+	{
+		size_t atom = b->atom[k];
+		if (output->U != NULL)			memcpy(&output->U[9 * atom], b->U[k], 9 * sizeof(double));
+		if (output->P != NULL)			memcpy(&output->P[9 * atom], b->P[k], 9 * sizeof(double));
+		if (output->von_mises_strain != NULL)	output->von_mises_strain[atom] = von_mises_strain(b->ratio[k], b->P[k]);
+	}
+
+	b->num = 0;
+}
+
+//neighbour pairs of one symmetry group, gathered for the batch disorientation kernels
+typedef struct
+{
+	std::vector<double> q0, q1, angles;
+	std::vector<int> atom;			//position of the central atom in the block
+} kampairs_t;
+
+//The KAM of a block of atoms.  Pairs are gathered for the whole block first, so the disorientations are calculated in
+//long runs and the per-atom data of the block stays in cache.
+static void kam_block(batchjob_t* job, int start, int end, kampairs_t* pairs)
+{
+	typedef void (*kernel_t)(int, const double*, const double*, double*);
+	const kernel_t kernels[3] = {quat_disorientations_cubic, quat_disorientations_hcp, quat_disorientations_icosahedral};
+
+	ptm_batch_handle_t handle = job->handle;
+	ptm_batch_output_t* output = job->output;
+	int32_t* types = output->type != NULL ? output->type : handle->kam_type;
+	double* q = output->q != NULL ? output->q : handle->kam_q;
+	int8_t* mapping = output->mapping != NULL ? output->mapping : handle->kam_mapping;
+
+	for (int g=0;g<3;g++)
+	{
+		pairs[g].q0.clear();
+		pairs[g].q1.clear();
+		pairs[g].atom.clear();
+	}
+
+	for (int i=start;i<end;i++)
+	{
+		int atom = job->order != NULL ? job->order[i] : i;
+		int32_t type = types[atom];
+		if (type == PTM_MATCH_NONE)
+			continue;
+
+		kampairs_t* p = &pairs[type == PTM_MATCH_HCP ? 1 : (type == PTM_MATCH_ICO ? 2 : 0)];
+		int8_t* m = &mapping[PTM_MAX_POINTS * (size_t)atom];
+		for (int k=1;k<=ptm_num_nbrs[type];k++)
+		{
+			if (m[k] < 1 || m[k] > job->num_nbrs)
+				continue;
+
+			int index = job->nbrs[(size_t)i * job->nbr_stride + m[k] - 1];
+			int nbr = job->order != NULL ? job->order[index] : index;
+			if (types[nbr] != type)
+				continue;
+
+			p->q0.insert(p->q0.end(), &q[4 * (size_t)atom], &q[4 * (size_t)atom + 4]);
+			p->q1.insert(p->q1.end(), &q[4 * (size_t)nbr], &q[4 * (size_t)nbr + 4]);
+			p->atom.push_back(i - start);
+		}
+	}
+
+	double sum[BLOCK_SIZE] = {0};
+	int count[BLOCK_SIZE] = {0};
+	double threshold = job->config->kam_threshold > 0 ? job->config->kam_threshold : INFINITY;
+	for (int g=0;g<3;g++)
+	{
+		int n = pairs[g].atom.size();
+		if (n == 0)
+			continue;
+
+		pairs[g].angles.resize(n);
+		kernels[g](n, pairs[g].q0.data(), pairs[g].q1.data(), pairs[g].angles.data());
+		for (int k=0;k<n;k++)
+		{
+			if (pairs[g].angles[k] < threshold)
+			{
+				sum[pairs[g].atom[k]] += pairs[g].angles[k];
+				count[pairs[g].atom[k]]++;
+			}
+		}
+	}
+
+	for (int i=start;i<end;i++)
+	{
+		int atom = job->order != NULL ? job->order[i] : i;
+		output->kam[atom] = count[i - start] > 0 ? sum[i - start] / count[i - start] : NAN;
+	}
+}
+
+//Each phase of the job runs on all workers and finishes when they are joined, so a phase that reads the results of every
+//block of the previous one needs no barrier of its own.  The workers of each phase work through their node's blocks
+//first, then help the other nodes.
+typedef void (*batchphase_t)(ptm_local_handle_t local_handle, batchjob_t* job, int thread, int node);
+
+//neighbours can lie in any block, so all ordered copies must be complete before indexing starts
+static void copy_phase(ptm_local_handle_t, batchjob_t* job, int, int node)
+{
+	for (int m=0;m<job->num_nodes;m++)
+	{
+		int n = (node + m) % job->num_nodes;
+		while (true)
+		{
+			int block = job->next_copy_block[n]++;
+			if (block >= job->block_end[n])
+				break;
+
+			copy_ordered_block(job, block * BLOCK_SIZE, std::min((block + 1) * BLOCK_SIZE, job->num_atoms));
+		}
+	}
+}
+
+static void index_phase(ptm_local_handle_t local_handle, batchjob_t* job, int thread, int node)
+{
+	int64_t num_indexed = 0;
+	polarblock_t* polar_block = (polarblock_t*)malloc(sizeof(polarblock_t));
+	polar_block->num = 0;
+	batchsummary_t* summary = job->thread_summary.size() > 0 ? &job->thread_summary[thread] : NULL;
+	gridblock_t* grid = NULL;
+	if (job->grid_partials.size() > 0)
+	{
+		grid = (gridblock_t*)malloc(sizeof(gridblock_t));
+		grid->num = 0;
+	}
+	for (int m=0;m<job->num_nodes;m++)
+	{
+		int n = (node + m) % job->num_nodes;
+		while (true)
+		{
+			int block = job->next_block[n]++;
+			if (block >= job->block_end[n])
+				break;
+
+			int start = block * BLOCK_SIZE;
+			int end = std::min(start + BLOCK_SIZE, job->num_atoms);
+			initialize_state_block(job, start, end);
+			int num_skipped = 0;
+			for (int i=start;i<end;i++)
+				num_skipped += index_atom(local_handle, job, i, polar_block, summary, grid);
+			decompose_block(job, polar_block);
+			if (grid != NULL)
+				flush_grid_block(job, thread, grid);
+			if (num_skipped > 0)
+				job->num_skipped += num_skipped;
+			num_indexed += end - start;
+		}
+	}
+	free(polar_block);
+	free(grid);
+
+	job->node_num_atoms[node] += num_indexed;
+}
+
+//the KAM needs the orientations of every neighbour, so it runs once all atoms have been indexed
+static void kam_phase(ptm_local_handle_t, batchjob_t* job, int, int node)
+{
+	kampairs_t pairs[3];
+	for (int m=0;m<job->num_nodes;m++)
+	{
+		int n = (node + m) % job->num_nodes;
+		while (true)
+		{
+			int block = job->next_kam_block[n]++;
+			if (block >= job->block_end[n])
+				break;
+
+			kam_block(job, block * BLOCK_SIZE, std::min((block + 1) * BLOCK_SIZE, job->num_atoms), pairs);
+		}
+	}
+}
+
+static void phase_worker(batchphase_t phase, ptm_local_handle_t local_handle, batchjob_t* job, int thread)
+{
+	auto start_time = std::chrono::steady_clock::now();
+
+	int node = thread_node(thread, job->num_threads, job->num_nodes);
+	if (job->pin_threads)
+		numa_pin_current_thread(job->handle->node_cpus[node]);
+
+	phase(local_handle, job, thread, node);
+	job->thread_time[thread] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+static void run_phase(batchjob_t* job, batchphase_t phase)
+{
+	ptm_batch_handle_t handle = job->handle;
+	if (job->num_threads <= 1)
+	{
+		phase_worker(phase, handle->local_handles[0], job, 0);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	for (int i=0;i<job->num_threads;i++)
+		threads.push_back(std::thread(phase_worker, phase, handle->local_handles[i], job, i));
+
+	for (int i=0;i<job->num_threads;i++)
+		threads[i].join();
+}
+
+ptm_batch_handle_t ptm_initialize_batch(int num_threads)
+{
+	if (ptm_initialize_global() != PTM_NO_ERROR)
+		return NULL;
+
+	if (num_threads <= 0)
+		num_threads = std::thread::hardware_concurrency();
+	if (num_threads <= 0)
+		num_threads = 1;
+
+	ptm_batch_handle_t handle = new ptm_batch;
+	handle->num_threads = num_threads;
+	for (int i=0;i<num_threads;i++)
+		handle->local_handles.push_back(ptm_initialize_local());
+	numa_detect_nodes(handle->node_cpus);
+
+	handle->valid = NULL;
+	handle->reference = NULL;
+	handle->reference_numbers = NULL;
+	handle->prev_type = NULL;
+	handle->prev_mapping = NULL;
+	handle->prev_nbrs = NULL;
+	handle->summary_record = NULL;
+	handle->kam_type = NULL;
+	handle->kam_q = NULL;
+	handle->kam_mapping = NULL;
+	handle->ordered_num_atoms = 0;
+	handle->ordered_num_nbrs = 0;
+	handle->ordered_positions = NULL;
+	handle->ordered_numbers = NULL;
+	handle->ordered_nbrs = NULL;
+
+	ptm_reset_batch(handle);
+	return handle;
+}
+
+void ptm_uninitialize_batch(ptm_batch_handle_t handle)
+{
+	for (size_t i=0;i<handle->local_handles.size();i++)
+		ptm_uninitialize_local(handle->local_handles[i]);
+
+	ptm_reset_batch(handle);
+	free(handle->ordered_positions);
+	free(handle->ordered_numbers);
+	free(handle->ordered_nbrs);
+	delete handle;
+}
+
+void ptm_reset_batch(ptm_batch_handle_t handle)
+{
+	handle->num_atoms = 0;
+	handle->num_nbrs = 0;
+	handle->flags = 0;
+	handle->topological_ordering = false;
+	handle->output_mask = 0;
+	handle->summarize = false;
+
+	free(handle->valid);
+	free(handle->reference);
+	free(handle->reference_numbers);
+	free(handle->prev_type);
+	free(handle->prev_mapping);
+	free(handle->prev_nbrs);
+	free(handle->summary_record);
+	free(handle->kam_type);
+	free(handle->kam_q);
+	free(handle->kam_mapping);
+	handle->valid = NULL;
+	handle->reference = NULL;
+	handle->reference_numbers = NULL;
+	handle->prev_type = NULL;
+	handle->prev_mapping = NULL;
+	handle->prev_nbrs = NULL;
+	handle->summary_record = NULL;
+	handle->kam_type = NULL;
+	handle->kam_q = NULL;
+	handle->kam_mapping = NULL;
+}
+
+static void prepare_state(ptm_batch_handle_t handle, const ptm_batch_config_t* config, int num_atoms, int num_nbrs, uint32_t output_mask,
+				bool* p_init_skip, bool* p_init_warm)
+{
+	if (	   handle->num_atoms != num_atoms
+		|| handle->num_nbrs != num_nbrs
+		|| handle->flags != config->flags
+		|| handle->topological_ordering != config->topological_ordering
+		|| handle->output_mask != output_mask
+		|| handle->summarize != config->summarize)
+	{
+		ptm_reset_batch(handle);
+		handle->num_atoms = num_atoms;
+		handle->num_nbrs = num_nbrs;
+		handle->flags = config->flags;
+		handle->topological_ordering = config->topological_ordering;
+		handle->output_mask = output_mask;
+		handle->summarize = config->summarize;
+	}
+
+	//A call without skipping overwrites the outputs but not the references, so the stored results are no longer those
+	//of the references and must not be reused when skipping is turned back on.
+	if (config->skip_tolerance <= 0 && handle->valid != NULL)
+	{
+		free(handle->valid);
+		free(handle->reference);
+		free(handle->reference_numbers);
+		free(handle->summary_record);
+		handle->valid = NULL;
+		handle->reference = NULL;
+		handle->reference_numbers = NULL;
+		handle->summary_record = NULL;
+	}
+
+	*p_init_skip = config->skip_tolerance > 0 && handle->valid == NULL;
+	if (*p_init_skip)
+	{
+		reallocate(&handle->valid, num_atoms);
+		reallocate(&handle->reference, (size_t)num_atoms * num_nbrs * 3);
+		reallocate(&handle->reference_numbers, (size_t)num_atoms * (num_nbrs + 1));
+		if (config->summarize || (output_mask & OUTPUT_GRID))
+			reallocate(&handle->summary_record, num_atoms);
+	}
+
+	*p_init_warm = config->warm_start_rmsd > 0 && handle->prev_type == NULL;
+	if (*p_init_warm)
+	{
+		reallocate(&handle->prev_type, num_atoms);
+		reallocate(&handle->prev_mapping, (size_t)num_atoms * PTM_MAX_POINTS);
+		reallocate(&handle->prev_nbrs, (size_t)num_atoms * num_nbrs);
+	}
+
+	//skipped atoms keep their stored orientations, so these persist like the outputs do
+	if ((output_mask & OUTPUT_KAM) && !(output_mask & OUTPUT_TYPE) && handle->kam_type == NULL)
+		reallocate(&handle->kam_type, num_atoms);
+	if ((output_mask & OUTPUT_KAM) && !(output_mask & OUTPUT_Q) && handle->kam_q == NULL)
+		reallocate(&handle->kam_q, 4 * (size_t)num_atoms);
+	if ((output_mask & OUTPUT_KAM) && !(output_mask & OUTPUT_MAPPING) && handle->kam_mapping == NULL)
+		reallocate(&handle->kam_mapping, (size_t)num_atoms * PTM_MAX_POINTS);
+}
+
+static void reduce_voxels(batchjob_t* job, int64_t begin, int64_t end)
+{
+	ptm_batch_grid_t* grid = job->output->grid;
+	const int num_types = PTM_MATCH_SC + 1;
+	for (int64_t v=begin;v<end;v++)
+	{
+		int64_t counts[num_types] = {0};
+		double rmsd = 0, lattice_constant = 0;
+		orientationsum_t orientation;
+		memset(&orientation, 0, sizeof(orientationsum_t));
+
+		//partial grids are merged in order, skipping those whose threads indexed nothing
+		for (size_t p=0;p<job->grid_partials.size();p++)
+		{
+			gridpartial_t* partial = &job->grid_partials[p];
+			if (partial->counts.size() == 0)
+				continue;
+
+			for (int j=0;j<num_types;j++)
+				counts[j] += partial->counts[v * num_types + j];
+
+			if (grid->mean_rmsd != NULL)			rmsd += partial->rmsd[v];
+			if (grid->mean_lattice_constant != NULL)	lattice_constant += partial->lattice_constant[v];
+			if (grid->orientation != NULL)			orientation_sum_merge(&orientation, &partial->orientation[v]);
+		}
+
+		int64_t num_matched = 0;
+		for (int j=PTM_MATCH_NONE+1;j<num_types;j++)
+			num_matched += counts[j];
+
+		if (grid->counts != NULL)			memcpy(&grid->counts[v * num_types], counts, num_types * sizeof(int64_t));
+		if (grid->mean_rmsd != NULL)			grid->mean_rmsd[v] = num_matched > 0 ? rmsd / num_matched : NAN;
+		if (grid->mean_lattice_constant != NULL)	grid->mean_lattice_constant[v] = num_matched > 0 ? lattice_constant / num_matched : NAN;
+		if (grid->orientation != NULL)
+		{
+			double spread;
+			orientation_sum_mean(&orientation, &grid->orientation[4 * v], &spread);
+		}
+	}
+}
+
+static void reduce_grid(batchjob_t* job)
+{
+	int64_t n = num_voxels(job->output->grid);
+	int num_threads = (int)std::max((int64_t)1, std::min((int64_t)job->num_threads, n / 4096));
+	if (num_threads <= 1)
+	{
+		reduce_voxels(job, 0, n);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	for (int i=0;i<num_threads;i++)
+		threads.push_back(std::thread(reduce_voxels, job, n * i / num_threads, n * (i + 1) / num_threads));
+
+	for (int i=0;i<num_threads;i++)
+		threads[i].join();
+}
+
+int ptm_index_batch(	ptm_batch_handle_t handle, const ptm_batch_config_t* config, int num_atoms, double* positions, int32_t* numbers,
+			int num_nbrs, int nbr_stride, int32_t* nbrs,
+			ptm_batch_output_t* output, ptm_batch_stats_t* stats)
+{
+	if (num_atoms < 0 || num_nbrs > MAX_BATCH_NBRS || nbr_stride < num_nbrs)
+		return PTM_BATCH_INVALID_ARGUMENT;
+
+	if ((config->flags & PTM_CHECK_SC) && num_nbrs < ptm_num_nbrs[PTM_MATCH_SC])
+		return PTM_BATCH_INVALID_ARGUMENT;
+
+	if ((config->flags & (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO)) && num_nbrs < ptm_num_nbrs[PTM_MATCH_FCC])
+		return PTM_BATCH_INVALID_ARGUMENT;
+
+	if ((config->flags & PTM_CHECK_BCC) && num_nbrs < ptm_num_nbrs[PTM_MATCH_BCC])
+		return PTM_BATCH_INVALID_ARGUMENT;
+
+	int ret = ptm_initialize_global();
+	if (ret != PTM_NO_ERROR)
+		return ret;
+
+	if (config->box != NULL && (config->box[0] <= 0 || config->box[1] <= 0 || config->box[2] <= 0))
+		return PTM_BATCH_INVALID_ARGUMENT;
+
+	ptm_batch_grid_t* grid = output->grid;
+	for (int j=0;j<3 && grid != NULL;j++)
+		if (grid->dims[j] <= 0 || !(grid->voxel_size[j] > 0))
+			return PTM_BATCH_INVALID_ARGUMENT;
+	if (grid != NULL && grid->orientation != NULL && (grid->orientation_type <= PTM_MATCH_NONE || grid->orientation_type > PTM_MATCH_SC))
+		return PTM_BATCH_INVALID_ARGUMENT;
+
+	for (size_t i=0;i<(size_t)num_atoms * nbr_stride;i++)
+		if (i % nbr_stride < (size_t)num_nbrs && (nbrs[i] < 0 || nbrs[i] >= num_atoms))
+			return PTM_BATCH_INVALID_ARGUMENT;
+
+	batchjob_t job;
+	prepare_state(handle, config, num_atoms, num_nbrs, get_output_mask(output), &job.init_skip, &job.init_warm);
+
+	job.handle = handle;
+	job.config = config;
+	job.num_atoms = num_atoms;
+	job.positions = positions;
+	job.numbers = numbers;
+	job.num_nbrs = num_nbrs;
+	job.nbr_stride = nbr_stride;
+	job.nbrs = nbrs;
+	job.order = NULL;
+	job.output = output;
+	job.input_positions = positions;
+	job.input_numbers = numbers;
+	job.input_stride = nbr_stride;
+	job.input_nbrs = nbrs;
+
+	if (config->spatial_ordering)
+	{
+		prepare_ordering(handle, num_atoms, positions, config->box, num_nbrs);
+		job.positions = handle->ordered_positions;
+		job.numbers = numbers != NULL ? handle->ordered_numbers : NULL;
+		job.nbr_stride = num_nbrs;
+		job.nbrs = handle->ordered_nbrs;
+		job.order = handle->order.data();
+
+		//the atoms of an ordered block are scattered over the per-atom state, so it cannot be initialized block by block
+		initialize_state_block(&job, 0, num_atoms);
+		job.init_skip = job.init_warm = false;
+	}
+
+	job.num_threads = num_worker_threads(handle, num_atoms);
+	job.num_nodes = num_worker_nodes(handle, config->numa_aware, job.num_threads);
+	job.pin_threads = config->numa_aware && job.num_threads > 1;
+	for (int n=0;n<PTM_BATCH_MAX_NODES;n++)
+	{
+		job.block_begin[n] = job.block_end[n] = 0;
+		if (n < job.num_nodes)
+			node_blocks(n, job.num_threads, job.num_nodes, num_blocks(num_atoms), &job.block_begin[n], &job.block_end[n]);
+
+		job.next_block[n] = job.block_begin[n];
+		job.next_copy_block[n] = job.block_begin[n];
+		job.next_kam_block[n] = job.block_begin[n];
+		job.node_num_atoms[n] = 0;
+	}
+	job.thread_time.assign(job.num_threads, 0);
+	if (config->summarize && stats != NULL)
+	{
+		batchsummary_t empty;
+		memset(&empty, 0, sizeof(batchsummary_t));
+		job.thread_summary.assign(job.num_threads, empty);
+	}
+
+	if (grid != NULL)
+	{
+		int num_partials = num_grid_partials(grid, job.num_threads);
+		job.grid_partials.resize(num_partials);
+		job.grid_locks.reset(new std::mutex[num_partials]);
+	}
+	job.num_skipped = 0;
+
+	if (job.order != NULL)
+		run_phase(&job, copy_phase);
+	run_phase(&job, index_phase);
+	if (output->kam != NULL)
+		run_phase(&job, kam_phase);
+
+	if (grid != NULL)
+		reduce_grid(&job);
+
+	if (stats != NULL)
+	{
+		stats->num_atoms = num_atoms;
+		stats->num_skipped = job.num_skipped;
+		stats->skipped_fraction = num_atoms > 0 ? (double)job.num_skipped / num_atoms : 0;
+
+		stats->num_nodes = job.num_nodes;
+		for (int n=0;n<PTM_BATCH_MAX_NODES;n++)
+		{
+			double elapsed = 0;
+			for (int i=0;i<job.num_threads;i++)
+				if (thread_node(i, job.num_threads, job.num_nodes) == n)
+					elapsed = std::max(elapsed, job.thread_time[i]);
+
+			stats->node_num_atoms[n] = job.node_num_atoms[n];
+			stats->node_throughput[n] = elapsed > 0 ? job.node_num_atoms[n] / elapsed : 0;
+		}
+
+		memset(stats->structure_counts, 0, sizeof(stats->structure_counts));
+		memset(stats->alloy_counts, 0, sizeof(stats->alloy_counts));
+		ptm_batch_histogram_t* histograms[3] = {&stats->rmsd_histogram, &stats->scale_histogram, &stats->lattice_constant_histogram};
+		const double* ranges[3] = {config->rmsd_range, config->scale_range, config->lattice_constant_range};
+		for (int h=0;h<3;h++)
+		{
+			histograms[h]->min = ranges[h][0];
+			histograms[h]->max = ranges[h][1];
+			memset(histograms[h]->counts, 0, sizeof(histograms[h]->counts));
+		}
+
+		for (size_t t=0;t<job.thread_summary.size();t++)
+		{
+			batchsummary_t* summary = &job.thread_summary[t];
+			for (int j=0;j<=PTM_MATCH_SC;j++)
+				stats->structure_counts[j] += summary->structure_counts[j];
+			for (int j=0;j<=PTM_ALLOY_B2;j++)
+				stats->alloy_counts[j] += summary->alloy_counts[j];
+
+			for (int h=0;h<3;h++)
+				for (int j=0;j<=PTM_MATCH_SC;j++)
+					for (int b=0;b<PTM_BATCH_HISTOGRAM_BINS;b++)
+						histograms[h]->counts[j][b] += summary->histograms[h][j][b];
+		}
+	}
+
+	return PTM_NO_ERROR;
+}
+
+static void touch_blocks(uint8_t* buffer, int num_atoms, size_t bytes_per_atom, int begin, int end, const std::vector<int>* cpus)
+{
+	if (cpus != NULL)
+		numa_pin_current_thread(*cpus);
+
+	size_t start = (size_t)begin * BLOCK_SIZE;
+	size_t stop = std::min((size_t)end * BLOCK_SIZE, (size_t)num_atoms);
+	if (stop > start)
+		memset(&buffer[start * bytes_per_atom], 0, (stop - start) * bytes_per_atom);
+}
+
+void* ptm_batch_allocate(ptm_batch_handle_t handle, int num_atoms, size_t bytes_per_atom)
+{
+	if (num_atoms < 0)
+		return NULL;
+
+	uint8_t* buffer = (uint8_t*)malloc(std::max((size_t)1, (size_t)num_atoms * bytes_per_atom));
+	if (buffer == NULL)
+		return NULL;
+
+	int num_threads = num_worker_threads(handle, num_atoms);
+	int num_nodes = num_worker_nodes(handle, true, num_threads);
+	if (num_nodes <= 1)
+	{
+		memset(buffer, 0, (size_t)num_atoms * bytes_per_atom);
+		return buffer;
+	}
+
+	//one pinned thread per node zeroes the blocks which that node's workers will index
+	std::vector<std::thread> threads;
+	for (int n=0;n<num_nodes;n++)
+	{
+		int begin, end;
+		node_blocks(n, num_threads, num_nodes, num_blocks(num_atoms), &begin, &end);
+		threads.push_back(std::thread(touch_blocks, buffer, num_atoms, bytes_per_atom, begin, end, &handle->node_cpus[n]));
+	}
+
+	for (int n=0;n<num_nodes;n++)
+		threads[n].join();
+
+	return buffer;
+}
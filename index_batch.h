@@ -0,0 +1,129 @@
+#ifndef INDEX_BATCH_H
+#define INDEX_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "index_ptm.h"
+
+//------------------------------------
+//    definitions
+//------------------------------------
+#define PTM_BATCH_INVALID_ARGUMENT	-1
+#define PTM_BATCH_MAX_NODES		8
+#define PTM_BATCH_HISTOGRAM_BINS	64
+
+//------------------------------------
+//    batch indexing
+//------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+	int32_t flags;
+	bool topological_ordering;
+	double* box;			//lengths of an orthorhombic periodic cell, or NULL for open boundaries
+	bool spatial_ordering;		//index atoms in Morton order for better cache locality (results are still written in input order)
+	bool numa_aware;		//pin workers to NUMA nodes and give each node a contiguous share of the atoms
+	double skip_tolerance;		//reuse the stored result of atoms whose neighbour vectors have moved less than this, and whose species are unchanged, since they were last indexed (0 disables, and discards the stored results)
+	double warm_start_rmsd;		//try the previous frame's correspondence first if the neighbour set is unchanged, accepting it below this rmsd (0 disables)
+	double kam_threshold;		//neighbours misoriented by this angle (radians) or more are left out of the KAM (0 includes all)
+	double reference_lattice_constant[PTM_MATCH_SC + 1];	//unstrained lattice constant of each structure, indexed by type, for the strain
+								//outputs.  0 measures strain relative to the atom's own lattice constant (shape only).
+	bool summarize;			//accumulate the structure counts and histograms of ptm_batch_stats_t
+	double rmsd_range[2];		//{min, max} of each histogram.  A histogram with max <= min is not accumulated.
+	double scale_range[2];
+	double lattice_constant_range[2];
+} ptm_batch_config_t;
+
+//Coarse-grained fields on a regular grid, accumulated by the workers in partial grids which are reduced at the end.  Each worker
+//has its own partial grid unless that would take more than max_partial_bytes in total, in which case workers share them.
+//Atoms are binned by position (wrapped into [0, box) in a periodic cell), and atoms outside the grid are not counted.
+typedef struct
+{
+	int32_t dims[3];		//voxels along x, y and z
+	double origin[3];		//lower corner of the grid
+	double voxel_size[3];
+	int32_t orientation_type;	//structure type whose atoms are averaged for the orientation output (orientations of different types are not comparable)
+	size_t max_partial_bytes;	//bound on the memory of the partial grids, 0 for the default of 1 GiB (at least one partial grid is always used)
+
+	//per-voxel outputs, x fastest.  NULL entries are not calculated.
+	int64_t* counts;		//PTM_MATCH_SC + 1 per voxel: number of atoms of each structure type
+	double* mean_rmsd;		//over the matched atoms, NaN if there are none
+	double* mean_lattice_constant;
+	double* orientation;		//4 per voxel: symmetry-aware mean orientation of the atoms of orientation_type, zero if there are none
+} ptm_batch_grid_t;
+
+//per-atom output arrays.  NULL entries are not calculated.
+typedef struct
+{
+	int32_t* type;
+	int32_t* alloy_type;
+	double* scale;
+	double* rmsd;
+	double* q;			//4 per atom
+	double* F;			//9 per atom
+	double* F_res;			//3 per atom
+	double* U;			//9 per atom
+	double* P;			//9 per atom
+	int8_t* mapping;		//PTM_MAX_POINTS per atom, indices into the neighbourhood (0 is the central atom, k is nbrs[k-1])
+	double* interatomic_distance;
+	double* lattice_constant;
+	double* von_mises_strain;	//von Mises shear strain of the left stretch tensor (P - I, with P scaled to the reference lattice constant)
+	double* volumetric_strain;	//det(F) - 1, with F taken relative to the reference lattice constant
+	double* green_lagrange;		//(F^T F - I) / 2, 9 per atom
+	double* kam;			//kernel average misorientation: mean disorientation (radians) to the mapped neighbours of the same structure,
+					//NaN if there are none.  Calculated in a second sweep once every atom has been indexed.
+	ptm_batch_grid_t* grid;		//coarse-grained fields, or NULL
+} ptm_batch_output_t;
+
+//PTM_BATCH_HISTOGRAM_BINS equal bins over [min, max) for each structure type.  Values outside the range go in the end bins.
+typedef struct
+{
+	double min;
+	double max;
+	int64_t counts[PTM_MATCH_SC + 1][PTM_BATCH_HISTOGRAM_BINS];
+} ptm_batch_histogram_t;
+
+typedef struct
+{
+	int64_t num_atoms;
+	int64_t num_skipped;		//atoms whose stored result was reused
+	double skipped_fraction;
+
+	int32_t num_nodes;				//NUMA nodes used, 1 unless numa_aware is set
+	int64_t node_num_atoms[PTM_BATCH_MAX_NODES];	//atoms indexed by the workers of each node
+	double node_throughput[PTM_BATCH_MAX_NODES];	//atoms per second
+
+	//summary of every atom in the frame, including skipped atoms, when config->summarize is set
+	int64_t structure_counts[PTM_MATCH_SC + 1];	//indexed by match type
+	int64_t alloy_counts[PTM_ALLOY_B2 + 1];		//indexed by alloy type
+	ptm_batch_histogram_t rmsd_histogram;		//matched atoms only
+	ptm_batch_histogram_t scale_histogram;
+	ptm_batch_histogram_t lattice_constant_histogram;
+} ptm_batch_stats_t;
+
+typedef struct ptm_batch* ptm_batch_handle_t;
+//The batch API initializes the library itself, so ptm_initialize_global need not be called first.
+ptm_batch_handle_t ptm_initialize_batch(int num_threads);	//num_threads = 0 uses all hardware threads
+void ptm_uninitialize_batch(ptm_batch_handle_t handle);
+void ptm_reset_batch(ptm_batch_handle_t handle);		//discards all stored per-atom state
+
+//Allocates a zeroed array of num_atoms x bytes_per_atom for batch results (release with free()).
+//Each page is first touched on the NUMA node whose workers index those atoms, when spatial_ordering is not used.
+void* ptm_batch_allocate(ptm_batch_handle_t handle, int num_atoms, size_t bytes_per_atom);
+
+//Indexes every atom using its first num_nbrs neighbours in nbrs (num_atoms x nbr_stride atom indices).
+//The handle keeps per-atom state between calls, so consecutive frames of a trajectory should use the same handle and the same output arrays.
+int ptm_index_batch(	ptm_batch_handle_t handle, const ptm_batch_config_t* config, int num_atoms, double* positions, int32_t* numbers,
+			int num_nbrs, int nbr_stride, int32_t* nbrs,		//inputs
+			ptm_batch_output_t* output, ptm_batch_stats_t* stats);	//outputs
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -5,9 +5,12 @@
 #include <cmath>
 #include <cfloat>
 #include <cassert>
+#include <algorithm>
+#include <mutex>
+#include <atomic>
 #include "convex_hull_incremental.hpp"
 #include "canonical.hpp"
-#include "graph_data.hpp"
+#include "graph_tables.hpp"
 #include "deformation_gradient.hpp"
 #include "alloy_types.hpp"
 #include "neighbour_ordering.hpp"
@@ -16,12 +19,14 @@
 #include "qcprot/qcprot.hpp"
 #include "qcprot/quat.hpp"
 #include "polar_decomposition.hpp"
+#include "point_dispatch.hpp"
 #include "index_ptm.h"
 
 
 #define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
 #define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
 
+#define MAX_INPUT_POINTS 19
 
 typedef struct
 {
@@ -29,10 +34,9 @@ typedef struct
 	int num_nbrs;
 	int num_facets;
 	int max_degree;
-	int num_graphs;
-	graph_t* graphs;
+	const graphtable_t* graphs;
 	const double (*points)[3];
-	const double (*penrose)[3];
+	const deformationtable_t* deformation;
 	const int8_t (*mapping)[15];
 } refdata_t;
 
@@ -42,159 +46,181 @@ typedef struct
 	double scale;
 	double q[4];		//rotation in quaternion form (rigid body transformation)
 	int8_t mapping[15];
-	refdata_t* ref_struct;
+	const refdata_t* ref_struct;
 } result_t;
 
 
-//refdata_t structure_sc =  { .type = PTM_MATCH_SC,  .num_nbrs =  6, .num_facets =  8, .max_degree = 4, .num_graphs = NUM_SC_GRAPHS,  .graphs = graphs_sc,  .points = ptm_template_sc,  .penrose = penrose_sc , .mapping = mapping_sc };
-refdata_t structure_sc =  { PTM_MATCH_SC,   6,  8, 4, NUM_SC_GRAPHS,  graphs_sc,  ptm_template_sc,  penrose_sc , mapping_sc };
-refdata_t structure_fcc = { PTM_MATCH_FCC, 12, 20, 6, NUM_FCC_GRAPHS, graphs_fcc, ptm_template_fcc, penrose_fcc, mapping_fcc};
-refdata_t structure_hcp = { PTM_MATCH_HCP, 12, 20, 6, NUM_HCP_GRAPHS, graphs_hcp, ptm_template_hcp, penrose_hcp, mapping_hcp};
-refdata_t structure_ico = { PTM_MATCH_ICO, 12, 20, 6, NUM_ICO_GRAPHS, graphs_ico, ptm_template_ico, penrose_ico, mapping_ico};
-refdata_t structure_bcc = { PTM_MATCH_BCC, 14, 24, 8, NUM_BCC_GRAPHS, graphs_bcc, ptm_template_bcc, penrose_bcc, mapping_bcc};
-
-static int graph_degree(int num_facets, int8_t facets[][3], int num_nodes, int8_t* degree)
-{
-	memset(degree, 0, sizeof(int8_t) * num_nodes);
+//refdata_t structure_sc =  { .type = PTM_MATCH_SC,  .num_nbrs =  6, .num_facets =  8, .max_degree = 4, .graphs = &graph_table_sc,  .points = ptm_template_sc,  .deformation = &deformation_sc , .mapping = mapping_sc };
+const refdata_t structure_sc =  { PTM_MATCH_SC,   6,  8, 4, &graph_table_sc,  ptm_template_sc,  &deformation_sc , mapping_sc };
+const refdata_t structure_fcc = { PTM_MATCH_FCC, 12, 20, 6, &graph_table_fcc, ptm_template_fcc, &deformation_fcc, mapping_fcc};
+const refdata_t structure_hcp = { PTM_MATCH_HCP, 12, 20, 6, &graph_table_hcp, ptm_template_hcp, &deformation_hcp, mapping_hcp};
+const refdata_t structure_ico = { PTM_MATCH_ICO, 12, 20, 6, &graph_table_ico, ptm_template_ico, &deformation_ico, mapping_ico};
+const refdata_t structure_bcc = { PTM_MATCH_BCC, 14, 24, 8, &graph_table_bcc, ptm_template_bcc, &deformation_bcc, mapping_bcc};
 
-	for (int i = 0;i<num_facets;i++)
-	{
-		int a = facets[i][0];
-		int b = facets[i][1];
-		int c = facets[i][2];
+//indexed by match type
+static const refdata_t* refdata[6] = {NULL, &structure_fcc, &structure_hcp, &structure_bcc, &structure_ico, &structure_sc};
 
-		degree[a]++;
-		degree[b]++;
-		degree[c]++;
-	}
+static bool degree_sequence_known(const refdata_t* s, uint64_t key)
+{
+	const graphtable_t* t = s->graphs;
+	const uint64_t* end = t->degree_sequences + t->num_degree_sequences;
+	const uint64_t* it = std::lower_bound(t->degree_sequences, end, key);
+	return it != end && *it == key;
+}
 
-	int8_t max_degree = 0;
-	for (int i = 0;i<num_nodes;i++)
-		max_degree = MAX(max_degree, degree[i]);
+//the graph tables are generated offline (see graph_tables.hpp), so there is nothing left to calculate here
+static std::once_flag initialize_flag;
+static int initialize_result = PTM_NO_ERROR;
+static std::atomic<bool> initialized(false);
 
-	return max_degree;
+static void initialize_global_once()
+{
+	initialize_result = PTM_NO_ERROR;
+	initialized.store(initialize_result == PTM_NO_ERROR, std::memory_order_release);
 }
 
-static void make_facets_clockwise(int num_facets, int8_t (*facets)[3], const double (*points)[3])
+bool ptm_is_initialized()
 {
-	double plane_normal[3];
-	double origin[3] = {0, 0, 0};
+	return initialized.load(std::memory_order_acquire);
+}
 
-	for (int i = 0;i<num_facets;i++)
-		add_facet(points, facets[i][0], facets[i][1], facets[i][2], facets[i], plane_normal, origin);
+//safe to call from any number of threads; the work is done once and every caller sees its result
+int ptm_initialize_global()
+{
+	std::call_once(initialize_flag, initialize_global_once);
+	return initialize_result;
 }
 
-static int initialize_graphs(refdata_t* s)
+//the kernels below are templated on the number of points (see point_dispatch.hpp)
+template <int N>
+static void calculate_gram_sums(int num_points, const double (*ideal_points)[3], const double (*normalized)[3], double* p_G1, double* p_G2)
 {
-	for (int i = 0;i<s->num_graphs;i++)
+	const int n = N > 0 ? N : num_points;
+	double G1 = 0, G2 = 0;
+	for (int i=0;i<n;i++)
 	{
-		int8_t degree[PTM_MAX_NBRS];
-		int _max_degree = graph_degree(s->num_facets, s->graphs[i].facets, s->num_nbrs, degree);
-		assert(_max_degree <= s->max_degree);
+		double x1 = ideal_points[i][0];
+		double y1 = ideal_points[i][1];
+		double z1 = ideal_points[i][2];
 
-		make_facets_clockwise(s->num_facets, s->graphs[i].facets, &s->points[1]);
-		int ret = canonical_form(s->num_facets, s->graphs[i].facets, s->num_nbrs, degree, s->graphs[i].canonical_labelling, &s->graphs[i].hash);
-		if (ret != 0)
-			return ret;
+		double x2 = normalized[i][0];
+		double y2 = normalized[i][1];
+		double z2 = normalized[i][2];
+
+		G1 += x1 * x1 + y1 * y1 + z1 * z1;
+		G2 += x2 * x2 + y2 * y2 + z2 * z2;
 	}
 
-	return PTM_NO_ERROR;
+	*p_G1 = G1;
+	*p_G2 = G2;
 }
 
-bool ptm_initialized = false;
-int ptm_initialize_global()
+//Calculates the scaled rmsd of the alignment of ideal_points[i] onto normalized[i].
+//Returns false, without calculating the rotation, if the rmsd cannot be smaller than max_rmsd.
+template <int N>
+static bool calculate_rmsd(int num_points, const double (*ideal_points)[3], const double (*normalized)[3], double G1, double G2, double max_rmsd, double* q, double* p_scale, double* p_rmsd)
 {
-	if (ptm_initialized)
-		return PTM_NO_ERROR;
+	const int n = N > 0 ? N : num_points;
+	double E0 = (G1 + G2) / 2;
+
+	double A0[9], rmsd;
+	InnerProduct<N>(A0, n, ideal_points, normalized);
+
+	//The scaled rmsd is sqrt((G1 - k0^2 / G2) / n), where k0 is the largest eigenvalue found by the QCP solver,
+	//so beating max_rmsd needs k0 > min_k0.  The eigenvalue is bounded by the sum of the singular values of A0,
+	//which is at most sqrt(3) times its Frobenius norm.
+	double minScore = -1;
+	double target = G1 - n * max_rmsd * max_rmsd;
+	if (max_rmsd < INFINITY && target > 0)
+	{
+		double min_k0 = sqrt(G2 * target);
+
+		double frobenius = 0;
+		for (int i=0;i<9;i++)
+			frobenius += A0[i] * A0[i];
+
+		if (3 * frobenius <= min_k0 * min_k0)
+			return false;
 
-	int ret = initialize_graphs(&structure_sc);
-	ret |= initialize_graphs(&structure_fcc);
-	ret |= initialize_graphs(&structure_hcp);
-	ret |= initialize_graphs(&structure_ico);
-	ret |= initialize_graphs(&structure_bcc);
+		minScore = sqrt(fabs(2 * (E0 - min_k0) / n));
+	}
+
+	double rot[9];
+	if (FastCalcRMSDAndRotation(q, A0, &rmsd, E0, n, minScore, rot) == -1)
+		return false;
+
+	double k0 = 0;
+	for (int ii=0;ii<n;ii++)
+	{
+		for (int jj=0;jj<3;jj++)
+		{
+			double v = 0.0;
+			for (int kk=0;kk<3;kk++)
+				v += rot[jj*3+kk] * ideal_points[ii][kk];
 
-	if (ret == PTM_NO_ERROR)
-		ptm_initialized = true;
+			k0 += v * normalized[ii][jj];
+		}
+	}
 
-	return ret;
+	double scale = k0 / G2;
+	*p_scale = scale;
+	*p_rmsd = sqrt(fabs(G1 - scale*k0) / n);
+	return true;
 }
 
-static void check_graphs(	refdata_t* s,
-				uint64_t hash,
-				int8_t* canonical_labelling,
-				double (*normalized)[3],
-				result_t* res)
+template <int N>
+static void check_graphs_kernel(	const refdata_t* s,
+					uint64_t hash,
+					int8_t* canonical_labelling,
+					double (*normalized)[3],
+					result_t* res)
 {
-	int num_points = s->num_nbrs + 1;
-	const double (*ideal_points)[3] = s->points;
+	const int num_points = N > 0 ? N : s->num_nbrs + 1;
 	int8_t inverse_labelling[PTM_MAX_POINTS];
-	int8_t mapping[PTM_MAX_POINTS];
+	double relabelled[PTM_MAX_POINTS][3];
 
 	for (int i=0; i<num_points; i++)
 		inverse_labelling[ canonical_labelling[i] ] = i;
 
-	double G1 = 0, G2 = 0;
-	for (int i=0;i<num_points;i++)
-	{
-		double x1 = ideal_points[i][0];
-		double y1 = ideal_points[i][1];
-		double z1 = ideal_points[i][2];
-
-		double x2 = normalized[i][0];
-		double y2 = normalized[i][1];
-		double z2 = normalized[i][2];
+	for (int i=0; i<num_points; i++)
+		memcpy(relabelled[i], normalized[inverse_labelling[i]], 3 * sizeof(double));
 
-		G1 += x1 * x1 + y1 * y1 + z1 * z1;
-		G2 += x2 * x2 + y2 * y2 + z2 * z2;
-	}
-	double E0 = (G1 + G2) / 2;
+	double G1 = 0, G2 = 0;
+	calculate_gram_sums<N>(num_points, s->points, (const double (*)[3])relabelled, &G1, &G2);
 
-	for (int i = 0;i<s->num_graphs;i++)
+	const graphtable_t* t = s->graphs;
+	const graphhash_t* end = t->hash_index + t->num_graphs;
+	const graphhash_t* it = std::lower_bound(t->hash_index, end, hash, [](const graphhash_t& a, uint64_t h) { return a.hash < h; });
+	for (;it != end && it->hash == hash;it++)
 	{
-		if (hash == s->graphs[i].hash)
+		const graph_t* gref = &t->graphs[it->graph];
+		const permutedtemplate_t* p = &t->templates[t->first_template[it->graph]];
+
+		for (int j = 0;j<gref->num_automorphisms;j++, p++)
 		{
-			graph_t* gref = &s->graphs[i];
+			double q[4], scale, rmsd;
+			if (!calculate_rmsd<N>(num_points, (const double (*)[3])p->points, (const double (*)[3])relabelled, G1, G2, res->rmsd, q, &scale, &rmsd))
+				continue;
 
-			for (int j = 0;j<gref->num_automorphisms;j++)
+			if (rmsd < res->rmsd)
 			{
+				res->rmsd = rmsd;
+				res->scale = scale;
+				res->ref_struct = s;
+				memcpy(res->q, q, 4 * sizeof(double));
 				for (int k=0;k<num_points;k++)
-					mapping[automorphisms[gref->automorphism_index + j][k]] = inverse_labelling[ gref->canonical_labelling[k] ];
-
-				double A0[9], q[4], rmsd;
-				InnerProduct(A0, num_points, ideal_points, normalized, mapping);
-
-				double rot[9];
-				FastCalcRMSDAndRotation(q, A0, &rmsd, E0, num_points, -1, rot);
-
-				double k0 = 0;
-				for (int ii=0;ii<num_points;ii++)
-				{
-					for (int jj=0;jj<3;jj++)
-					{
-						double v = 0.0;
-						for (int kk=0;kk<3;kk++)
-							v += rot[jj*3+kk] * ideal_points[ii][kk];
-
-						k0 += v * normalized[mapping[ii]][jj];
-					}
-				}
-
-				double scale = k0 / G2;
-				rmsd = sqrt(fabs(G1 - scale*k0) / num_points);
-				if (rmsd < res->rmsd)
-				{
-					res->rmsd = rmsd;
-					res->scale = scale;
-					res->ref_struct = s;
-					memcpy(res->q, q, 4 * sizeof(double));
-					memcpy(res->mapping, mapping, sizeof(int8_t) * num_points);
-				}
+					res->mapping[p->template_index[k]] = inverse_labelling[k];
 			}
 		}
 	}
 }
 
-static int match_general(refdata_t* s, double (*ch_points)[3], double* points, convexhull_t* ch, result_t* res)
+static void check_graphs(const refdata_t* s, uint64_t hash, int8_t* canonical_labelling, double (*normalized)[3], result_t* res)
+{
+	DISPATCH_NUM_POINTS(s->num_nbrs + 1, check_graphs_kernel, s, hash, canonical_labelling, normalized, res);
+}
+
+static int match_general(const refdata_t* s, double (*ch_points)[3], double (*normalized)[3], convexhull_t* ch, result_t* res)
 {
 	int8_t degree[PTM_MAX_NBRS];
 	int8_t facets[PTM_MAX_FACETS][3];
@@ -211,13 +237,9 @@ static int match_general(refdata_t* s, double (*ch_points)[3], double* points, c
 	if (max_degree > s->max_degree)
 		return PTM_NO_ERROR;
 
-	if (s->type == PTM_MATCH_SC)
-		for (int i = 0;i<s->num_nbrs;i++)
-			if (degree[i] != 4)
-				return PTM_NO_ERROR;
-
-	double normalized[PTM_MAX_POINTS][3];
-	subtract_barycentre(s->num_nbrs + 1, points, normalized);
+	//no reference graph has this degree sequence, so the canonical form cannot match
+	if (!degree_sequence_known(s, degree_sequence_key(s->num_nbrs, degree)))
+		return PTM_NO_ERROR;
 
 	int8_t canonical_labelling[PTM_MAX_POINTS];
 	uint64_t hash = 0;
@@ -236,7 +258,7 @@ static int match_general(refdata_t* s, double (*ch_points)[3], double* points, c
 	return PTM_NO_ERROR;
 }
 
-static int match_fcc_hcp_ico(double (*ch_points)[3], double* points, int32_t flags, convexhull_t* ch, result_t* res)
+static int match_fcc_hcp_ico(double (*ch_points)[3], double (*normalized)[3], int32_t flags, convexhull_t* ch, result_t* res)
 {
 	int num_nbrs = structure_fcc.num_nbrs;
 	int num_facets = structure_fcc.num_facets;
@@ -257,8 +279,12 @@ static int match_fcc_hcp_ico(double (*ch_points)[3], double* points, int32_t fla
 	if (_max_degree > max_degree)
 		return PTM_NO_ERROR;
 
-	double normalized[PTM_MAX_POINTS][3];
-	subtract_barycentre(num_nbrs + 1, points, normalized);
+	uint64_t key = degree_sequence_key(num_nbrs, degree);
+	bool check_fcc = (flags & PTM_CHECK_FCC) && degree_sequence_known(&structure_fcc, key);
+	bool check_hcp = (flags & PTM_CHECK_HCP) && degree_sequence_known(&structure_hcp, key);
+	bool check_ico = (flags & PTM_CHECK_ICO) && degree_sequence_known(&structure_ico, key);
+	if (!check_fcc && !check_hcp && !check_ico)
+		return PTM_NO_ERROR;
 
 	int8_t canonical_labelling[PTM_MAX_POINTS];
 	uint64_t hash = 0;
@@ -273,9 +299,9 @@ static int match_fcc_hcp_ico(double (*ch_points)[3], double* points, int32_t fla
 		printf("%2d ", degree[i]);
 	printf("\n");
 #endif
-	if (flags & PTM_CHECK_FCC)	check_graphs(&structure_fcc, hash, canonical_labelling, normalized, res);
-	if (flags & PTM_CHECK_HCP)	check_graphs(&structure_hcp, hash, canonical_labelling, normalized, res);
-	if (flags & PTM_CHECK_ICO)	check_graphs(&structure_ico, hash, canonical_labelling, normalized, res);
+	if (check_fcc)	check_graphs(&structure_fcc, hash, canonical_labelling, normalized, res);
+	if (check_hcp)	check_graphs(&structure_hcp, hash, canonical_labelling, normalized, res);
+	if (check_ico)	check_graphs(&structure_ico, hash, canonical_labelling, normalized, res);
 	return PTM_NO_ERROR;
 }
 
@@ -300,6 +326,70 @@ static double calculate_interatomic_distance(int type, double scale)
 	return c[type] / scale;
 }
 
+//centred holds the neighbourhood of the matched structure, centred on its barycentre
+static void output_data(result_t* res, double (*centred)[3], int32_t* numbers, int8_t* ordering,
+			int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, int8_t* mapping, double* p_interatomic_distance, double* p_lattice_constant)
+{
+	const refdata_t* ref = res->ref_struct;
+	if (ref != NULL)
+	{
+		*p_type = ref->type;
+
+		if (p_alloy_type != NULL && numbers != NULL)
+		{
+			if (ref->type == PTM_MATCH_FCC)
+				*p_alloy_type = find_fcc_alloy_type(res->mapping, numbers);
+			else if (ref->type == PTM_MATCH_BCC)
+				*p_alloy_type = find_bcc_alloy_type(res->mapping, numbers);
+		}
+
+		int bi = -1;
+		if      (ref->type == PTM_MATCH_SC)	bi = rotate_quaternion_into_cubic_fundamental_zone(res->q);
+		else if (ref->type == PTM_MATCH_FCC)	bi = rotate_quaternion_into_cubic_fundamental_zone(res->q);
+		else if (ref->type == PTM_MATCH_BCC)	bi = rotate_quaternion_into_cubic_fundamental_zone(res->q);
+		else if (ref->type == PTM_MATCH_ICO)	bi = rotate_quaternion_into_icosahedral_fundamental_zone(res->q);
+		else if (ref->type == PTM_MATCH_HCP)	bi = rotate_quaternion_into_hcp_fundamental_zone(res->q);
+
+		int8_t temp[15];
+		for (int i=0;i<ref->num_nbrs+1;i++)
+			temp[ref->mapping[bi][i]] = res->mapping[i];
+
+		memcpy(res->mapping, temp, (ref->num_nbrs+1) * sizeof(int8_t));
+
+		if (F != NULL && F_res != NULL)
+		{
+			double normalized[PTM_MAX_POINTS][3];
+			for (int i = 0;i<ref->num_nbrs + 1;i++)
+			{
+				normalized[i][0] = centred[i][0] * res->scale;
+				normalized[i][1] = centred[i][1] * res->scale;
+				normalized[i][2] = centred[i][2] * res->scale;
+			}
+			calculate_deformation_gradient(ref->deformation, res->mapping, normalized, F, F_res);
+
+			if (P != NULL && U != NULL)
+				polar_decomposition_3x3(F, false, U, P);
+		}
+
+		if (mapping != NULL)
+			for (int i=0;i<ref->num_nbrs + 1;i++)
+				mapping[i] = ordering[res->mapping[i]];
+
+		double interatomic_distance = calculate_interatomic_distance(ref->type, res->scale);
+		double lattice_constant = calculate_lattice_constant(ref->type, interatomic_distance);
+
+		if (p_interatomic_distance != NULL)
+			*p_interatomic_distance = interatomic_distance;
+
+		if (p_lattice_constant != NULL)
+			*p_lattice_constant = lattice_constant;
+	}
+
+	*p_rmsd = res->rmsd;
+	*p_scale = res->scale;
+	memcpy(q, res->q, 4 * sizeof(double));
+}
+
 int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermuted_points, int32_t* unpermuted_numbers, int32_t flags, bool topological_ordering,
 		int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, int8_t* mapping, double* p_interatomic_distance, double* p_lattice_constant)
 {
@@ -312,8 +402,6 @@ int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermut
 	if (flags & (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO))
 		assert(num_points >= structure_fcc.num_nbrs + 1);
 
-
-#define MAX_INPUT_POINTS 19
 	assert(num_points <= MAX_INPUT_POINTS);
 
 	int ret = 0;
@@ -342,9 +430,22 @@ int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermut
 			numbers[i] = unpermuted_numbers[ordering[i]];
 	}
 
+	//The barycentres of every prefix come from one pass over the points.  Each structure size is centred once, and
+	//the centred points are shared by the matching of that size and by the deformation gradient of the best match.
+	double barycentres[PTM_MAX_POINTS + 1][3];
+	prefix_barycentres(num_points, (double*)points, barycentres);
+
 	convexhull_t ch;
 	ch.ok = false;
-	normalize_vertices(num_points, (double*)points, ch_points);
+	normalize_vertices_about(num_points, (double*)points, barycentres[num_points], ch_points);
+
+	double centred_sc[PTM_MAX_POINTS][3], centred_fcc[PTM_MAX_POINTS][3], centred_bcc[PTM_MAX_POINTS][3];
+	if (flags & PTM_CHECK_SC)
+		subtract_point(structure_sc.num_nbrs + 1, (double*)points, barycentres[structure_sc.num_nbrs + 1], centred_sc);
+	if (flags & (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO))
+		subtract_point(structure_fcc.num_nbrs + 1, (double*)points, barycentres[structure_fcc.num_nbrs + 1], centred_fcc);
+	if (flags & PTM_CHECK_BCC)
+		subtract_point(structure_bcc.num_nbrs + 1, (double*)points, barycentres[structure_bcc.num_nbrs + 1], centred_bcc);
 
 #ifdef DEBUG
 	for (int i = 0;i<num_points;i++)
@@ -364,7 +465,7 @@ int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermut
 
 	if (flags & PTM_CHECK_SC)
 	{
-		ret = match_general(&structure_sc, ch_points, (double*)points, &ch, &res);
+		ret = match_general(&structure_sc, ch_points, centred_sc, &ch, &res);
 		//if (ret != PTM_NO_ERROR)
 		//	return ret;
 #ifdef DEBUG
@@ -374,7 +475,7 @@ int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermut
 
 	if (flags & (PTM_CHECK_FCC | PTM_CHECK_HCP | PTM_CHECK_ICO))
 	{
-		ret = match_fcc_hcp_ico(ch_points, (double*)points, flags, &ch, &res);
+		ret = match_fcc_hcp_ico(ch_points, centred_fcc, flags, &ch, &res);
 		//if (ret != PTM_NO_ERROR)
 		//	return ret;
 #ifdef DEBUG
@@ -384,7 +485,7 @@ int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermut
 
 	if (flags & PTM_CHECK_BCC)
 	{
-		ret = match_general(&structure_bcc, ch_points, (double*)points, &ch, &res);
+		ret = match_general(&structure_bcc, ch_points, centred_bcc, &ch, &res);
 		//if (ret != PTM_NO_ERROR)
 		//	return ret;
 #ifdef DEBUG
@@ -392,66 +493,138 @@ int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* unpermut
 #endif
 	}
 
-	refdata_t* ref = res.ref_struct;
-	if (ref != NULL)
+	double (*centred)[3] = NULL;
+	if (res.ref_struct == &structure_sc)
+		centred = centred_sc;
+	else if (res.ref_struct == &structure_bcc)
+		centred = centred_bcc;
+	else if (res.ref_struct != NULL)
+		centred = centred_fcc;
+
+	output_data(&res, centred, unpermuted_numbers != NULL ? numbers : NULL, ordering,
+			p_type, p_alloy_type, p_scale, p_rmsd, q, F, F_res, U, P, mapping, p_interatomic_distance, p_lattice_constant);
+	return PTM_NO_ERROR;
+}
+
+//Tries the correspondence found for the previous frame: a single QCP solve instead of the full search.
+static bool match_previous(const refdata_t* ref, int num_points, double* unpermuted_points, int32_t* unpermuted_numbers, int8_t* prev_mapping, double max_rmsd,
+				double (*normalized)[3], int32_t* numbers, int8_t* ordering, result_t* res)
+{
+	int n = ref->num_nbrs + 1;
+	if (num_points < n || prev_mapping[0] != 0)
+		return false;
+
+	double points[PTM_MAX_POINTS][3];
+	bool used[MAX_INPUT_POINTS] = {false};
+	for (int i=0;i<n;i++)
 	{
-		*p_type = ref->type;
+		int index = prev_mapping[i];
+		if (index < 0 || index >= num_points || used[index])
+			return false;
 
-		if (p_alloy_type != NULL && unpermuted_numbers != NULL)
-		{
-			if (ref->type == PTM_MATCH_FCC)
-				*p_alloy_type = find_fcc_alloy_type(res.mapping, numbers);
-			else if (ref->type == PTM_MATCH_BCC)
-				*p_alloy_type = find_bcc_alloy_type(res.mapping, numbers);
-		}
+		used[index] = true;
+		ordering[i] = index;
+		memcpy(points[i], &unpermuted_points[3 * index], 3 * sizeof(double));
 
-		int bi = -1;
-		if      (ref->type == PTM_MATCH_SC)	bi = rotate_quaternion_into_cubic_fundamental_zone(res.q);
-		else if (ref->type == PTM_MATCH_FCC)	bi = rotate_quaternion_into_cubic_fundamental_zone(res.q);
-		else if (ref->type == PTM_MATCH_BCC)	bi = rotate_quaternion_into_cubic_fundamental_zone(res.q);
-		else if (ref->type == PTM_MATCH_ICO)	bi = rotate_quaternion_into_icosahedral_fundamental_zone(res.q);
-		else if (ref->type == PTM_MATCH_HCP)	bi = rotate_quaternion_into_hcp_fundamental_zone(res.q);
+		if (unpermuted_numbers != NULL)
+			numbers[i] = unpermuted_numbers[index];
+	}
 
-		int8_t temp[15];
-		for (int i=0;i<ref->num_nbrs+1;i++)
-			temp[ref->mapping[bi][i]] = res.mapping[i];
+	subtract_barycentre(n, (double*)points, normalized);
 
-		memcpy(res.mapping, temp, (ref->num_nbrs+1) * sizeof(int8_t));
+	int8_t identity[PTM_MAX_POINTS];
+	for (int i=0;i<n;i++)
+		identity[i] = i;
 
-		if (F != NULL && F_res != NULL)
+	double G1 = 0, G2 = 0;
+	calculate_gram_sums<0>(n, ref->points, (const double (*)[3])normalized, &G1, &G2);
+
+	double q[4], scale, rmsd;
+	if (!calculate_rmsd<0>(n, ref->points, (const double (*)[3])normalized, G1, G2, max_rmsd, q, &scale, &rmsd))
+		return false;
+
+	if (!(rmsd < max_rmsd))
+		return false;
+
+	res->rmsd = rmsd;
+	res->scale = scale;
+	res->ref_struct = ref;
+	memcpy(res->q, q, 4 * sizeof(double));
+	memcpy(res->mapping, identity, sizeof(int8_t) * n);
+	return true;
+}
+
+//The previous mapping refers to neighbour positions of the previous frame.  If the neighbour set is unchanged it is
+//carried over to the current positions, so that a reordered neighbour list still warm starts.  Otherwise the previous
+//correspondence is meaningless and false is returned.
+static bool remap_previous(int num_nbrs, const int32_t* prev_nbr_ids, const int32_t* nbr_ids, const int8_t* prev_mapping, int8_t* remapped)
+{
+	//position[k] is the current position of the previous frame's neighbour k
+	int8_t position[MAX_INPUT_POINTS];
+	bool used[MAX_INPUT_POINTS] = {false};
+	for (int k=0;k<num_nbrs;k++)
+	{
+		position[k] = -1;
+		for (int j=0;j<num_nbrs;j++)
 		{
-			subtract_barycentre(ref->num_nbrs + 1, (double*)points, ch_points);
-			for (int i = 0;i<ref->num_nbrs + 1;i++)
+			if (!used[j] && nbr_ids[j] == prev_nbr_ids[k])
 			{
-				ch_points[i][0] *= res.scale;
-				ch_points[i][1] *= res.scale;
-				ch_points[i][2] *= res.scale;
+				used[j] = true;
+				position[k] = j;
+				break;
 			}
-			calculate_deformation_gradient(ref->num_nbrs + 1, ref->points, res.mapping, ch_points, ref->penrose, F, F_res);
-
-			if (P != NULL && U != NULL)
-				polar_decomposition_3x3(F, false, U, P);
 		}
 
-		if (mapping != NULL)
-			for (int i=0;i<ref->num_nbrs + 1;i++)
-				mapping[i] = ordering[res.mapping[i]];
+		if (position[k] == -1)
+			return false;
+	}
 
-		double interatomic_distance = calculate_interatomic_distance(ref->type, res.scale);
-		double lattice_constant = calculate_lattice_constant(ref->type, interatomic_distance);
+	for (int k=0;k<PTM_MAX_POINTS;k++)
+	{
+		int index = prev_mapping[k];
+		remapped[k] = index >= 1 && index <= num_nbrs ? position[index - 1] + 1 : index;
+	}
 
-		if (p_interatomic_distance != NULL)
-			*p_interatomic_distance = interatomic_distance;
+	return true;
+}
 
-		if (p_lattice_constant != NULL)
-			*p_lattice_constant = lattice_constant;
-	}
+int ptm_index_warm_start(	ptm_local_handle_t local_handle, int num_points, double* unpermuted_points, int32_t* unpermuted_numbers, int32_t flags, bool topological_ordering,
+				int32_t prev_type, int8_t* prev_mapping, const int32_t* prev_nbr_ids, const int32_t* nbr_ids, double max_rmsd,
+				int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, int8_t* mapping, double* p_interatomic_distance, double* p_lattice_constant)
+{
+	assert(num_points <= MAX_INPUT_POINTS);
 
-	*p_rmsd = res.rmsd;
-	*p_scale = res.scale;
-	memcpy(q, res.q, 4 * sizeof(double));
+	const refdata_t* ref = NULL;
+	int8_t remapped[PTM_MAX_POINTS];
+	if (prev_type >= 1 && prev_type <= 5 && (flags & (1 << (prev_type - 1))) && prev_mapping != NULL && prev_nbr_ids != NULL && nbr_ids != NULL
+		&& remap_previous(num_points - 1, prev_nbr_ids, nbr_ids, prev_mapping, remapped))
+		ref = refdata[prev_type];
 
-	return PTM_NO_ERROR;
+	if (ref != NULL)
+	{
+		double centred[PTM_MAX_POINTS][3];
+		int32_t numbers[PTM_MAX_POINTS];
+		int8_t ordering[PTM_MAX_POINTS];
+
+		result_t res;
+		res.ref_struct = NULL;
+		res.rmsd = INFINITY;
+		if (match_previous(ref, num_points, unpermuted_points, unpermuted_numbers, remapped, max_rmsd, centred, numbers, ordering, &res))
+		{
+			if (p_alloy_type != NULL)
+				*p_alloy_type = PTM_ALLOY_NONE;
+
+			if (mapping != NULL)
+				memset(mapping, -1, MIN(15, num_points) * sizeof(int8_t));
+
+			output_data(&res, centred, unpermuted_numbers != NULL ? numbers : NULL, ordering,
+					p_type, p_alloy_type, p_scale, p_rmsd, q, F, F_res, U, P, mapping, p_interatomic_distance, p_lattice_constant);
+			return PTM_NO_ERROR;
+		}
+	}
+
+	return ptm_index(	local_handle, num_points, unpermuted_points, unpermuted_numbers, flags, topological_ordering,
+				p_type, p_alloy_type, p_scale, p_rmsd, q, F, F_res, U, P, mapping, p_interatomic_distance, p_lattice_constant);
 }
 
 ptm_local_handle_t ptm_initialize_local()
@@ -51,11 +51,21 @@ int ptm_initialize_global();
 int ptm_index(	ptm_local_handle_t local_handle, int num_points, double* atomic_positions, int32_t* atomic_numbers, int32_t flags, bool topological_ordering,										//inputs
 		int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, int8_t* mapping, double* p_interatomic_distance, double* p_lattice_constant);	//outputs
 
+//Incremental indexing for trajectories.  The previous frame's type and mapping are tried first, with a single rotation fit; the
+//result is accepted if the rmsd is below max_rmsd, otherwise the full template search is run.  prev_nbr_ids and nbr_ids identify
+//the num_points - 1 neighbours (e.g. by atom index) in the previous and current frames.  The previous mapping is only tried if
+//the two sets are the same, and is carried over to the current order of the neighbours.
+int ptm_index_warm_start(	ptm_local_handle_t local_handle, int num_points, double* atomic_positions, int32_t* atomic_numbers, int32_t flags, bool topological_ordering,	//inputs
+				int32_t prev_type, int8_t* prev_mapping, const int32_t* prev_nbr_ids, const int32_t* nbr_ids, double max_rmsd,						//previous result
+				int32_t* p_type, int32_t* p_alloy_type, double* p_scale, double* p_rmsd, double* q, double* F, double* F_res, double* U, double* P, int8_t* mapping, double* p_interatomic_distance, double* p_lattice_constant);	//outputs
+
 
 //------------------------------------
 //    global initialization switch
 //------------------------------------
-extern bool ptm_initialized;
+//True once ptm_initialize_global has completed successfully.  Threads should call ptm_initialize_global (which is thread-safe and
+//idempotent) rather than polling this.
+bool ptm_is_initialized();
 
 //------------------------------------
 //    number of neighbours
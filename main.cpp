@@ -4,7 +4,13 @@
 #include <cstdlib>
 #include <string.h>
 #include <cassert>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <unistd.h>
 #include "index_ptm.h"
+#include "index_batch.h"
+#include "neighbour_list.h"
 #include "unittest.hpp"
 
 #define _MAX_NBRS 24
@@ -66,9 +72,113 @@ static void get_neighbours(double (*positions)[3], int32_t* nbrs, int max_nbrs,
 	}
 }
 
-int main()
+//synthetic large system: a periodic, thermally perturbed fcc crystal with atoms stored in random order
+static int build_shuffled_fcc(int n, double lattice_constant, double* positions)
+{
+	const double basis[4][3] = {{0, 0, 0}, {0.5, 0.5, 0}, {0.5, 0, 0.5}, {0, 0.5, 0.5}};
+
+	int num_atoms = 0;
+	for (int i=0;i<n;i++)
+		for (int j=0;j<n;j++)
+			for (int k=0;k<n;k++)
+				for (int b=0;b<4;b++)
+				{
+					double* p = &positions[3 * num_atoms++];
+					p[0] = lattice_constant * (i + basis[b][0]) + 0.02 * sin(1.3 * num_atoms);
+					p[1] = lattice_constant * (j + basis[b][1]) + 0.02 * cos(2.1 * num_atoms);
+					p[2] = lattice_constant * (k + basis[b][2]) + 0.02 * sin(0.7 * num_atoms);
+				}
+
+	srand(1);
+	for (int i=num_atoms-1;i>0;i--)
+	{
+		int j = rand() % (i + 1);
+		for (int l=0;l<3;l++)
+		{
+			double temp = positions[3 * i + l];
+			positions[3 * i + l] = positions[3 * j + l];
+			positions[3 * j + l] = temp;
+		}
+	}
+
+	return num_atoms;
+}
+
+//Spatial ordering can only help once the inputs no longer fit in the last-level cache.  n = 0 picks a system of at least a
+//million atoms and twice the size of the LLC.  Run with "benchmark --ordering [n]".
+static int benchmark_spatial_ordering(int n)
+{
+	const int num_nbrs = 18;
+	const double lattice_constant = 2.0;
+	size_t bytes_per_atom = 3 * sizeof(double) + num_nbrs * sizeof(int32_t) + sizeof(int32_t) + 4 * sizeof(double);	//inputs and outputs
+	long llc = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+	llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+	if (n <= 0)
+		n = std::max(64, (int)ceil(cbrt(2.0 * llc / (4 * bytes_per_atom))));
+
+	double box[3] = {n * lattice_constant, n * lattice_constant, n * lattice_constant};
+	int max_atoms = 4 * n * n * n;
+	printf("working set: %.1f MB, last-level cache: %.1f MB\n", max_atoms * bytes_per_atom / 1E6, llc / 1E6);
+
+	double* positions = (double*)malloc(3 * max_atoms * sizeof(double));
+	int32_t* nbrs = (int32_t*)malloc(max_atoms * num_nbrs * sizeof(int32_t));
+	int32_t* types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+	double* quats = (double*)malloc(4 * max_atoms * sizeof(double));
+	int num_atoms = build_shuffled_fcc(n, lattice_constant, positions);
+
+	ptm_nbrlist_handle_t nbrlist = ptm_initialize_nbrlist(1.2 * lattice_constant, 0.1 * lattice_constant);
+	int ret = ptm_find_neighbours(nbrlist, num_atoms, positions, box, num_nbrs, nbrs, NULL);
+	ptm_uninitialize_nbrlist(nbrlist);
+
+	ptm_batch_output_t output;
+	memset(&output, 0, sizeof(ptm_batch_output_t));
+	output.type = types;
+	output.q = quats;
+
+	ptm_batch_config_t config;
+	memset(&config, 0, sizeof(ptm_batch_config_t));
+	config.flags = PTM_CHECK_ALL;
+	config.topological_ordering = true;
+	config.box = box;
+	config.summarize = true;
+
+	ptm_batch_stats_t stats;
+	ptm_batch_handle_t batch_handle = ptm_initialize_batch(0);
+	for (int ordered=0;ordered<2 && ret == PTM_NO_ERROR;ordered++)
+	{
+		config.spatial_ordering = ordered;
+
+		auto start = std::chrono::steady_clock::now();
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		printf("%s order: %d atoms (%ld fcc) in %f s, %.0f atoms/s\n", ordered ? "spatial" : "input", num_atoms, (long)stats.structure_counts[PTM_MATCH_FCC], elapsed, num_atoms / elapsed);
+	}
+
+	//NUMA-aware placement, with per-node throughput
+	config.numa_aware = true;
+	if (ret == PTM_NO_ERROR)
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+
+	for (int n=0;n<stats.num_nodes && ret == PTM_NO_ERROR;n++)
+		printf("numa node %d: %ld atoms, %.0f atoms/s\n", n, (long)stats.node_num_atoms[n], stats.node_throughput[n]);
+
+	ptm_uninitialize_batch(batch_handle);
+	free(positions);
+	free(nbrs);
+	free(types);
+	free(quats);
+	return ret;
+}
+
+int main(int argc, char** argv)
 {
 	ptm_initialize_global();
+	if (argc > 1 && strcmp(argv[1], "--ordering") == 0)
+		return benchmark_spatial_ordering(argc > 2 ? atoi(argv[2]) : 0);
+
 	uint64_t res = run_tests();
 	assert(res == 0);
 	//printf("=========================================================\n");
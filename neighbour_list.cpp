@@ -0,0 +1,275 @@
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <algorithm>
+#include "index_ptm.h"
+#include "neighbour_list.h"
+
+
+#define MAX_LIST_NBRS 64
+
+struct ptm_nbrlist
+{
+	double cutoff;
+	double skin;
+
+	//state at the last rebuild
+	int num_atoms;
+	bool periodic;
+	double box[3];
+	std::vector<double> reference;		//positions
+	std::vector<int32_t> offsets;		//candidates of atom i are candidates[offsets[i]] .. candidates[offsets[i+1] - 1]
+	std::vector<int32_t> candidates;
+};
+
+typedef struct
+{
+	double distsq;
+	int32_t index;
+} nbrhelper_t;
+
+static bool nbrhelper_compare(nbrhelper_t const& a, nbrhelper_t const& b)
+{
+	if (a.distsq < b.distsq)
+		return true;
+
+	if (a.distsq > b.distsq)
+		return false;
+
+	return a.index < b.index;
+}
+
+static void minimum_image(bool periodic, const double* box, double* delta)
+{
+	if (!periodic)
+		return;
+
+	for (int j=0;j<3;j++)
+		delta[j] -= box[j] * round(delta[j] / box[j]);
+}
+
+static double distance_squared(bool periodic, const double* box, const double* a, const double* b)
+{
+	double delta[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+	minimum_image(periodic, box, delta);
+	return delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+}
+
+static void rebuild(ptm_nbrlist_handle_t handle, int num_atoms, double* positions, double* box)
+{
+	double rc = handle->cutoff + handle->skin;
+	double rcsq = rc * rc;
+
+	handle->num_atoms = num_atoms;
+	handle->periodic = box != NULL;
+	if (box != NULL)
+		memcpy(handle->box, box, 3 * sizeof(double));
+	handle->reference.assign(positions, positions + 3 * (size_t)num_atoms);
+
+	//cell grid
+	double lo[3], length[3];
+	for (int j=0;j<3;j++)
+	{
+		if (handle->periodic)
+		{
+			lo[j] = 0;
+			length[j] = box[j];
+		}
+		else
+		{
+			double dmin = DBL_MAX, dmax = -DBL_MAX;
+			for (int i=0;i<num_atoms;i++)
+			{
+				dmin = std::min(dmin, positions[3 * i + j]);
+				dmax = std::max(dmax, positions[3 * i + j]);
+			}
+
+			lo[j] = dmin;
+			length[j] = std::max(dmax - dmin, rc) * (1 + 1E-9);
+		}
+	}
+
+	//cells are at least rc wide, and are widened further when a sparse system (e.g. one with a distant outlier) would
+	//otherwise need more than about two cells per atom
+	int64_t max_cells = std::max((int64_t)27, 2 * (int64_t)num_atoms);
+	int nc[3];
+	for (double size=rc;;size*=1.25)
+	{
+		int64_t total = 1;
+		for (int j=0;j<3;j++)
+		{
+			nc[j] = std::max(1, std::min(1024, (int)(length[j] / size)));
+			total *= nc[j];
+		}
+
+		if (total <= max_cells)
+			break;
+	}
+
+	//sort atoms into cells
+	int num_cells = nc[0] * nc[1] * nc[2];
+	std::vector<int> cell_of(num_atoms);
+	std::vector<int> cell_start(num_cells + 1, 0);
+	std::vector<int32_t> cell_atoms(num_atoms);
+	for (int i=0;i<num_atoms;i++)
+	{
+		int c[3];
+		for (int j=0;j<3;j++)
+		{
+			double f = (positions[3 * i + j] - lo[j]) / length[j];
+			if (handle->periodic)
+				f -= floor(f);
+
+			c[j] = std::min(nc[j] - 1, std::max(0, (int)(f * nc[j])));
+		}
+
+		cell_of[i] = (c[0] * nc[1] + c[1]) * nc[2] + c[2];
+		cell_start[cell_of[i] + 1]++;
+	}
+
+	for (int c=0;c<num_cells;c++)
+		cell_start[c + 1] += cell_start[c];
+
+	std::vector<int> fill(cell_start.begin(), cell_start.end() - 1);
+	for (int i=0;i<num_atoms;i++)
+		cell_atoms[fill[cell_of[i]]++] = i;
+
+	//collect candidates from the 27 surrounding cells
+	handle->offsets.assign(num_atoms + 1, 0);
+	handle->candidates.clear();
+	for (int i=0;i<num_atoms;i++)
+	{
+		int cx = cell_of[i] / (nc[1] * nc[2]);
+		int cy = (cell_of[i] / nc[2]) % nc[1];
+		int cz = cell_of[i] % nc[2];
+
+		int cells[27];
+		int num_nbr_cells = 0;
+		for (int dx=-1;dx<=1;dx++)
+		for (int dy=-1;dy<=1;dy++)
+		for (int dz=-1;dz<=1;dz++)
+		{
+			int x = cx + dx, y = cy + dy, z = cz + dz;
+			if (handle->periodic)
+			{
+				x = (x + nc[0]) % nc[0];
+				y = (y + nc[1]) % nc[1];
+				z = (z + nc[2]) % nc[2];
+			}
+			else if (x < 0 || x >= nc[0] || y < 0 || y >= nc[1] || z < 0 || z >= nc[2])
+			{
+				continue;
+			}
+
+			//small periodic grids wrap onto the same cell more than once
+			int c = (x * nc[1] + y) * nc[2] + z;
+			if (std::find(cells, cells + num_nbr_cells, c) == cells + num_nbr_cells)
+				cells[num_nbr_cells++] = c;
+		}
+
+		for (int k=0;k<num_nbr_cells;k++)
+		{
+			int c = cells[k];
+			for (int l=cell_start[c];l<cell_start[c + 1];l++)
+			{
+				int j = cell_atoms[l];
+				if (j != i && distance_squared(handle->periodic, handle->box, &positions[3 * i], &positions[3 * j]) < rcsq)
+					handle->candidates.push_back(j);
+			}
+		}
+
+		handle->offsets[i + 1] = handle->candidates.size();
+	}
+}
+
+static bool needs_rebuild(ptm_nbrlist_handle_t handle, int num_atoms, double* positions, double* box)
+{
+	if (handle->num_atoms != num_atoms || handle->periodic != (box != NULL))
+		return true;
+
+	if (box != NULL && memcmp(handle->box, box, 3 * sizeof(double)) != 0)
+		return true;
+
+	double limit = handle->skin / 2;
+	double limitsq = limit * limit;
+	for (int i=0;i<num_atoms;i++)
+		if (distance_squared(handle->periodic, handle->box, &handle->reference[3 * i], &positions[3 * i]) > limitsq)
+			return true;
+
+	return false;
+}
+
+ptm_nbrlist_handle_t ptm_initialize_nbrlist(double cutoff, double skin)
+{
+	ptm_nbrlist_handle_t handle = new ptm_nbrlist;
+	handle->cutoff = cutoff;
+	handle->skin = skin;
+	handle->num_atoms = -1;
+	handle->periodic = false;
+	handle->box[0] = handle->box[1] = handle->box[2] = 0;
+	return handle;
+}
+
+void ptm_uninitialize_nbrlist(ptm_nbrlist_handle_t handle)
+{
+	delete handle;
+}
+
+int ptm_find_neighbours(ptm_nbrlist_handle_t handle, int num_atoms, double* positions, double* box, int num_nbrs,
+			int32_t* nbrs, bool* p_rebuilt)
+{
+	if (num_atoms < 0 || num_nbrs <= 0 || num_nbrs > MAX_LIST_NBRS || handle->cutoff <= 0 || handle->skin < 0)
+		return PTM_NBRLIST_INVALID_ARGUMENT;
+
+	//distances use the minimum image, which is only the nearest image of every atom within the cutoff and skin if
+	//the cell is at least twice as wide
+	double rc = handle->cutoff + handle->skin;
+	if (box != NULL && !(box[0] >= 2 * rc && box[1] >= 2 * rc && box[2] >= 2 * rc))
+		return PTM_NBRLIST_INVALID_ARGUMENT;
+
+	bool rebuilt = needs_rebuild(handle, num_atoms, positions, box);
+	if (rebuilt)
+		rebuild(handle, num_atoms, positions, box);
+
+	if (p_rebuilt != NULL)
+		*p_rebuilt = rebuilt;
+
+	//atoms beyond the cutoff may have been missed by the list, so every atom needs num_nbrs candidates within it.
+	//This is checked for all atoms before any neighbours are written.
+	double cutoffsq = handle->cutoff * handle->cutoff;
+	for (int i=0;i<num_atoms;i++)
+	{
+		int start = handle->offsets[i];
+		int end = handle->offsets[i + 1];
+		int num_within = 0;
+		for (int k=start;k<end;k++)
+			num_within += distance_squared(handle->periodic, handle->box, &positions[3 * i], &positions[3 * handle->candidates[k]]) < cutoffsq;
+
+		if (num_within < num_nbrs)
+			return PTM_NBRLIST_CUTOFF_TOO_SMALL;
+	}
+
+	//select the nearest neighbours from the cached candidates, using current positions
+	std::vector<nbrhelper_t> data;
+	for (int i=0;i<num_atoms;i++)
+	{
+		int start = handle->offsets[i];
+		int end = handle->offsets[i + 1];
+		data.resize(end - start);
+		for (int k=start;k<end;k++)
+		{
+			int j = handle->candidates[k];
+			data[k - start].distsq = distance_squared(handle->periodic, handle->box, &positions[3 * i], &positions[3 * j]);
+			data[k - start].index = j;
+		}
+
+		std::partial_sort(data.begin(), data.begin() + num_nbrs, data.end(), &nbrhelper_compare);
+		for (int k=0;k<num_nbrs;k++)
+			nbrs[(size_t)i * num_nbrs + k] = data[k].index;
+	}
+
+	return PTM_NO_ERROR;
+}
+
@@ -0,0 +1,36 @@
+#ifndef NEIGHBOUR_LIST_H
+#define NEIGHBOUR_LIST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//------------------------------------
+//    definitions
+//------------------------------------
+#define PTM_NBRLIST_INVALID_ARGUMENT	-1
+#define PTM_NBRLIST_CUTOFF_TOO_SMALL	-2	//fewer than num_nbrs atoms within the cutoff
+
+//------------------------------------
+//    neighbour lists
+//------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Verlet list: candidates within (cutoff + skin) are cached and only rebuilt once an atom has moved further than skin / 2.
+typedef struct ptm_nbrlist* ptm_nbrlist_handle_t;
+ptm_nbrlist_handle_t ptm_initialize_nbrlist(double cutoff, double skin);
+void ptm_uninitialize_nbrlist(ptm_nbrlist_handle_t handle);
+
+//Writes the num_nbrs nearest neighbours of each atom, sorted by distance, to nbrs (num_atoms x num_nbrs).
+//box holds the lengths of an orthorhombic periodic cell, or NULL for open boundaries.  Distances use the minimum image, so
+//each box length must be at least 2 * (cutoff + skin).  On error nbrs is left unchanged.
+int ptm_find_neighbours(ptm_nbrlist_handle_t handle, int num_atoms, double* positions, double* box, int num_nbrs,	//inputs
+			int32_t* nbrs, bool* p_rebuilt);								//outputs
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -1,9 +1,9 @@
 #include <cmath>
+#include "normalize_vertices.hpp"
 
 
-void subtract_barycentre(int num, double *points, double (*normalized)[3])
+static void calculate_barycentre(int num, double *points, double* barycentre)
 {
-	//calculate barycentre
 	double sum[3] = {0, 0, 0};
 	for (int i=0;i<num;i++)
 	{
@@ -12,22 +12,40 @@ void subtract_barycentre(int num, double *points, double (*normalized)[3])
 		sum[2] += points[i * 3 + 2];
 	}
 
-	sum[0] /= num;
-	sum[1] /= num;
-	sum[2] /= num;
+	barycentre[0] = sum[0] / num;
+	barycentre[1] = sum[1] / num;
+	barycentre[2] = sum[2] / num;
+}
 
-	//subtract barycentre
+void subtract_point(int num, double *points, const double* origin, double (*normalized)[3])
+{
 	for (int i=0;i<num;i++)
 	{
-		normalized[i][0] = points[i * 3 + 0] - sum[0];
-		normalized[i][1] = points[i * 3 + 1] - sum[1];
-		normalized[i][2] = points[i * 3 + 2] - sum[2];
+		normalized[i][0] = points[i * 3 + 0] - origin[0];
+		normalized[i][1] = points[i * 3 + 1] - origin[1];
+		normalized[i][2] = points[i * 3 + 2] - origin[2];
 	}
 }
 
-double normalize_vertices(int num, double *points, double (*normalized)[3])
+void prefix_barycentres(int num, double *points, double (*barycentres)[3])
 {
-	subtract_barycentre(num, points, normalized);
+	double sum[3] = {0, 0, 0};
+	barycentres[0][0] = barycentres[0][1] = barycentres[0][2] = 0;
+	for (int i=0;i<num;i++)
+	{
+		sum[0] += points[i * 3 + 0];
+		sum[1] += points[i * 3 + 1];
+		sum[2] += points[i * 3 + 2];
+
+		barycentres[i + 1][0] = sum[0] / (i + 1);
+		barycentres[i + 1][1] = sum[1] / (i + 1);
+		barycentres[i + 1][2] = sum[2] / (i + 1);
+	}
+}
+
+double normalize_vertices_about(int num, double *points, const double* barycentre, double (*normalized)[3])
+{
+	subtract_point(num, points, barycentre, normalized);
 
 	//calculate mean length
 	double scale = 0.0;
@@ -53,3 +71,17 @@ double normalize_vertices(int num, double *points, double (*normalized)[3])
 	return scale;
 }
 
+void subtract_barycentre(int num, double *points, double (*normalized)[3])
+{
+	double barycentre[3];
+	calculate_barycentre(num, points, barycentre);
+	subtract_point(num, points, barycentre, normalized);
+}
+
+double normalize_vertices(int num, double *points, double (*normalized)[3])
+{
+	double barycentre[3];
+	calculate_barycentre(num, points, barycentre);
+	return normalize_vertices_about(num, points, barycentre, normalized);
+}
+
@@ -4,5 +4,10 @@
 void subtract_barycentre(int num, double *points, double (*normalized)[3]);
 double normalize_vertices(int num, double *points, double (*normalized)[3]);
 
+//barycentres[n] is the barycentre of the first n points (barycentres needs num + 1 entries)
+void prefix_barycentres(int num, double *points, double (*barycentres)[3]);
+void subtract_point(int num, double *points, const double* origin, double (*normalized)[3]);
+double normalize_vertices_about(int num, double *points, const double* barycentre, double (*normalized)[3]);
+
 #endif
 
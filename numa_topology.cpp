@@ -0,0 +1,106 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#include <pthread.h>
+#endif
+#include "numa_topology.hpp"
+
+#define MAX_SYSFS_NODES 64
+
+
+#ifdef __linux__
+//parses a sysfs cpu list such as "0-3,8-11"
+static void parse_cpulist(const char* s, std::vector<int>& cpus)
+{
+	while (*s != '\0' && *s != '\n')
+	{
+		char* end;
+		long lo = strtol(s, &end, 10);
+		if (end == s)
+			break;
+
+		long hi = lo;
+		s = end;
+		if (*s == '-')
+		{
+			hi = strtol(s + 1, &end, 10);
+			s = end;
+		}
+
+		for (long c=lo;c<=hi;c++)
+			cpus.push_back((int)c);
+
+		if (*s == ',')
+			s++;
+	}
+}
+#endif
+
+int numa_detect_nodes(std::vector< std::vector<int> >& node_cpus)
+{
+	node_cpus.clear();
+
+#ifdef __linux__
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	bool have_mask = sched_getaffinity(0, sizeof(cpu_set_t), &allowed) == 0;
+
+	int num_found = 0;
+
+	for (int node=0;node<MAX_SYSFS_NODES;node++)
+	{
+		char path[128];
+		snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+		FILE* fin = fopen(path, "r");
+		if (fin == NULL)
+			continue;
+
+		char line[4096];
+		std::vector<int> cpus, usable;
+		if (fgets(line, sizeof(line), fin) != NULL)
+			parse_cpulist(line, cpus);
+		fclose(fin);
+
+		//skip cpus outside our affinity mask, and memory-only nodes
+		for (size_t i=0;i<cpus.size();i++)
+			if (cpus[i] < CPU_SETSIZE && (!have_mask || CPU_ISSET(cpus[i], &allowed)))
+				usable.push_back(cpus[i]);
+
+		if (usable.size() == 0)
+			continue;
+
+		//fold any excess nodes onto the supported number
+		if (num_found < NUMA_MAX_NODES)
+			node_cpus.push_back(usable);
+		else
+			node_cpus[num_found % NUMA_MAX_NODES].insert(node_cpus[num_found % NUMA_MAX_NODES].end(), usable.begin(), usable.end());
+		num_found++;
+	}
+#endif
+
+	if (node_cpus.size() == 0)
+		node_cpus.push_back(std::vector<int>());
+
+	return node_cpus.size();
+}
+
+bool numa_pin_current_thread(const std::vector<int>& cpus)
+{
+#ifdef __linux__
+	if (cpus.size() == 0)
+		return false;
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (size_t i=0;i<cpus.size();i++)
+		CPU_SET(cpus[i], &set);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+#else
+	(void)cpus;
+	return false;
+#endif
+}
+
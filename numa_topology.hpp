@@ -0,0 +1,15 @@
+#ifndef NUMA_TOPOLOGY_HPP
+#define NUMA_TOPOLOGY_HPP
+
+#include <vector>
+
+#define NUMA_MAX_NODES 8
+
+//Lists the usable cpus of each NUMA node.  Falls back to a single node with an empty cpu list (no pinning) if the topology is unavailable.
+int numa_detect_nodes(std::vector< std::vector<int> >& node_cpus);
+
+//Restricts the calling thread to the given cpus.  Returns false if this is not supported.
+bool numa_pin_current_thread(const std::vector<int>& cpus);
+
+#endif
+
@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include "index_ptm.h"
+#include "qcprot/quat.hpp"
+#include "orientation_sum.hpp"
+
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+#define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+static int (*fundamental_zone(int32_t type))(double*)
+{
+	if (type == PTM_MATCH_HCP)
+		return rotate_quaternion_into_hcp_fundamental_zone;
+	else if (type == PTM_MATCH_ICO)
+		return rotate_quaternion_into_icosahedral_fundamental_zone;
+	return rotate_quaternion_into_cubic_fundamental_zone;
+}
+
+static void conjugate(const double* q, double* c)
+{
+	c[0] = q[0];
+	c[1] = -q[1];
+	c[2] = -q[2];
+	c[3] = -q[3];
+}
+
+//the symmetric variant of q nearest to reference: reference * (reference^-1 q reduced into the fundamental zone)
+static void nearest_variant(int32_t type, double* reference, double* q, double* variant)
+{
+	double inverse[4], relative[4];
+	conjugate(reference, inverse);
+	quat_rot(inverse, q, relative);
+	fundamental_zone(type)(relative);
+	quat_rot(reference, relative, variant);
+}
+
+void orientation_sum_add(orientationsum_t* s, int32_t type, const double* q)
+{
+	if (s->count == 0)
+	{
+		s->type = type;
+		memcpy(s->reference, q, 4 * sizeof(double));
+	}
+
+	double aligned[4];
+	nearest_variant(s->type, s->reference, (double*)q, aligned);
+
+	s->count++;
+	for (int i=0;i<4;i++)
+	{
+		s->sum[i] += aligned[i];
+		for (int j=0;j<4;j++)
+			s->scatter[i][j] += aligned[i] * aligned[j];
+	}
+}
+
+//Adds a partial sum.  The members of the partial sum were aligned to its own reference, so they are moved onto the variants
+//of this sum with the symmetry operation g taking the partial reference to its variant nearest the reference of this sum.
+//Right-multiplication by g is linear, so the sum and scatter can be transformed as a whole.
+void orientation_sum_merge(orientationsum_t* s, const orientationsum_t* p)
+{
+	if (p->count == 0)
+		return;
+
+	if (s->count == 0)
+	{
+		*s = *p;
+		return;
+	}
+
+	double variant[4], inverse[4], g[4];
+	nearest_variant(s->type, s->reference, (double*)p->reference, variant);
+	conjugate(p->reference, inverse);
+	quat_rot(inverse, variant, g);
+
+	//matrix of q -> q * g
+	double A[4][4] = {	{g[0], -g[1], -g[2], -g[3]},
+				{g[1],  g[0],  g[3], -g[2]},
+				{g[2], -g[3],  g[0],  g[1]},
+				{g[3],  g[2], -g[1],  g[0]}	};
+
+	double sum[4] = {0, 0, 0, 0}, temp[4][4] = {{0}};
+	for (int i=0;i<4;i++)
+		for (int j=0;j<4;j++)
+		{
+			sum[i] += A[i][j] * p->sum[j];
+			for (int k=0;k<4;k++)
+				temp[i][j] += A[i][k] * p->scatter[k][j];
+		}
+
+	s->count += p->count;
+	for (int i=0;i<4;i++)
+	{
+		s->sum[i] += sum[i];
+		for (int j=0;j<4;j++)
+			for (int k=0;k<4;k++)
+				s->scatter[i][j] += temp[i][k] * A[j][k];
+	}
+}
+
+void orientation_sum_mean(const orientationsum_t* s, double* mean, double* p_spread)
+{
+	mean[0] = mean[1] = mean[2] = mean[3] = 0;
+	*p_spread = 0;
+	if (s->count == 0)
+		return;
+
+	memcpy(mean, s->sum, 4 * sizeof(double));
+	normalize_quaternion(mean);
+
+	//sum of (q.mean)^2 = mean^T scatter mean
+	double sq = 0;
+	for (int i=0;i<4;i++)
+		for (int j=0;j<4;j++)
+			sq += mean[i] * s->scatter[i][j] * mean[j];
+
+	*p_spread = 2 * acos(MIN(1, sqrt(MAX(0, sq / s->count))));
+	fundamental_zone(s->type)(mean);
+}
+
@@ -0,0 +1,24 @@
+#ifndef ORIENTATION_SUM_HPP
+#define ORIENTATION_SUM_HPP
+
+#include <cstdint>
+
+//Symmetry-aware running sum of orientations.  Each orientation is brought into the symmetric variant nearest the first one
+//added, and the sum takes its structure type from that orientation.  A zeroed orientationsum_t is empty.
+typedef struct
+{
+	int32_t type;
+	int64_t count;
+	double reference[4];		//orientation every member is aligned to
+	double sum[4];			//sum of the aligned orientations
+	double scatter[4][4];		//sum of their outer products
+} orientationsum_t;
+
+void orientation_sum_add(orientationsum_t* s, int32_t type, const double* q);
+void orientation_sum_merge(orientationsum_t* s, const orientationsum_t* p);
+
+//Mean orientation, reduced into the fundamental zone, and the spread 2 acos(sqrt(<(q.mean)^2>)).  Both are zero for an empty sum.
+void orientation_sum_mean(const orientationsum_t* s, double* mean, double* p_spread);
+
+#endif
+
@@ -0,0 +1,42 @@
+#ifndef PARALLEL_RANGES_HPP
+#define PARALLEL_RANGES_HPP
+
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+//num_threads <= 0 uses all hardware threads, but never so many that a thread has fewer than min_items_per_thread items
+static inline int num_worker_threads(int num_threads, int64_t num_items, int64_t min_items_per_thread)
+{
+	if (num_threads <= 0)
+		num_threads = std::thread::hardware_concurrency();
+
+	int64_t max_threads = std::max((int64_t)1, num_items / min_items_per_thread);
+	return (int)std::max((int64_t)1, std::min((int64_t)num_threads, max_threads));
+}
+
+//runs work(begin, end) over contiguous shares of [0, num_items)
+template <typename F>
+static void parallel_ranges(int num_threads, int64_t num_items, F work)
+{
+	if (num_threads == 1)
+	{
+		work((int64_t)0, num_items);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	for (int i=0;i<num_threads;i++)
+	{
+		int64_t begin = num_items * i / num_threads;
+		int64_t end = num_items * (i + 1) / num_threads;
+		threads.push_back(std::thread(work, begin, end));
+	}
+
+	for (size_t i=0;i<threads.size();i++)
+		threads[i].join();
+}
+
+#endif
+
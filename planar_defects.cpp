@@ -0,0 +1,156 @@
+#include <cstdint>
+#include <cmath>
+#include "index_ptm.h"
+#include "qcprot/quat.hpp"
+#include "planar_defects.h"
+#include "parallel_ranges.hpp"
+
+
+//out-of-plane neighbours of a {111} layer are at cos = +-0.816 to its normal, in-plane neighbours at 0
+#define LAYER_THRESHOLD 0.4
+
+//c axis of the hcp template: neighbours 1, 3 and 5 lie above the basal plane, 2, 4 and 6 below it, and 7-12 in it
+static const double hcp_c_axis[3] = {0.577350269190, 0.577350269190, 0.577350269190};
+
+typedef struct
+{
+	int num;
+	int num_fcc;
+	int num_hcp;
+	int32_t fcc[PTM_MAX_NBRS];	//members, for following the layers further
+	int32_t hcp[PTM_MAX_NBRS];
+} layer_t;
+
+typedef struct
+{
+	int num_atoms;
+	const int32_t* types;
+	const double* q;
+	const int8_t* mapping;
+	int nbr_stride;
+	const int32_t* nbrs;
+} defectinput_t;
+
+static bool is_hcp_layer(layer_t* layer)
+{
+	return 2 * layer->num_hcp > layer->num;
+}
+
+static bool is_fcc_layer(layer_t* layer)
+{
+	return 2 * layer->num_fcc > layer->num;
+}
+
+//adds the neighbours of atom i lying on one side (+1 or -1) of the plane with the lab-frame normal
+static void add_layer(const defectinput_t* in, int32_t i, const double* normal, int side, layer_t* layer)
+{
+	int32_t type = in->types[i];
+	const double (*points)[3] = NULL;
+	if (type == PTM_MATCH_FCC)
+		points = ptm_template_fcc;
+	else if (type == PTM_MATCH_HCP)
+		points = ptm_template_hcp;
+	else
+		return;
+
+	//the template is rotated into the lab frame by U, so the normal is brought into the template frame by U^T
+	double U[9];
+	quaternion_to_rotation_matrix((double*)&in->q[4 * (size_t)i], U);
+
+	double m[3];
+	for (int j=0;j<3;j++)
+		m[j] = U[j] * normal[0] + U[3 + j] * normal[1] + U[6 + j] * normal[2];
+
+	const int8_t* mapping = &in->mapping[(size_t)i * PTM_MAX_POINTS];
+	for (int k=1;k<=ptm_num_nbrs[type];k++)
+	{
+		double d = points[k][0] * m[0] + points[k][1] * m[1] + points[k][2] * m[2];
+		if (side * d < LAYER_THRESHOLD)
+			continue;
+
+		int index = mapping[k];
+		if (index < 1 || index > in->nbr_stride)
+			continue;
+
+		int32_t j = in->nbrs[(size_t)i * in->nbr_stride + index - 1];
+		if (j < 0 || j >= in->num_atoms)
+			continue;
+
+		layer->num++;
+		if (in->types[j] == PTM_MATCH_FCC && layer->num_fcc < PTM_MAX_NBRS)
+			layer->fcc[layer->num_fcc++] = j;
+		else if (in->types[j] == PTM_MATCH_HCP && layer->num_hcp < PTM_MAX_NBRS)
+			layer->hcp[layer->num_hcp++] = j;
+	}
+}
+
+//the layer beyond the next one: neighbours of the given atoms on the same side
+static void add_next_layer(const defectinput_t* in, int num, const int32_t* atoms, const double* normal, int side, layer_t* layer)
+{
+	for (int k=0;k<num;k++)
+		add_layer(in, atoms[k], normal, side, layer);
+}
+
+static int32_t classify_atom(const defectinput_t* in, int32_t i)
+{
+	if (in->types[i] != PTM_MATCH_HCP)
+		return PTM_PLANAR_NONE;
+
+	double U[9], normal[3];
+	quaternion_to_rotation_matrix((double*)&in->q[4 * (size_t)i], U);
+	for (int j=0;j<3;j++)
+		normal[j] = U[3 * j] * hcp_c_axis[0] + U[3 * j + 1] * hcp_c_axis[1] + U[3 * j + 2] * hcp_c_axis[2];
+
+	layer_t above = {}, below = {};
+	add_layer(in, i, normal, 1, &above);
+	add_layer(in, i, normal, -1, &below);
+
+	bool hcp_above = is_hcp_layer(&above), hcp_below = is_hcp_layer(&below);
+	if (hcp_above && hcp_below)
+		return PTM_PLANAR_OTHER;
+
+	if (hcp_above || hcp_below)
+	{
+		//two hcp layers between fcc layers
+		int side = hcp_above ? 1 : -1;
+		layer_t* partner = hcp_above ? &above : &below;
+		layer_t* other = hcp_above ? &below : &above;
+
+		layer_t beyond = {};
+		add_next_layer(in, partner->num_hcp, partner->hcp, normal, side, &beyond);
+		return is_fcc_layer(other) && is_fcc_layer(&beyond) ? PTM_PLANAR_ISF : PTM_PLANAR_OTHER;
+	}
+
+	if (!is_fcc_layer(&above) || !is_fcc_layer(&below))
+		return PTM_PLANAR_OTHER;
+
+	//a single hcp layer is a twin boundary, unless there is another one fcc layer away
+	layer_t beyond_above = {}, beyond_below = {};
+	add_next_layer(in, above.num_fcc, above.fcc, normal, 1, &beyond_above);
+	add_next_layer(in, below.num_fcc, below.fcc, normal, -1, &beyond_below);
+	if (is_hcp_layer(&beyond_above) || is_hcp_layer(&beyond_below))
+		return PTM_PLANAR_ESF;
+
+	return PTM_PLANAR_TWIN;
+}
+
+int ptm_classify_planar_defects(	int num_atoms, const int32_t* types, const double* q, const int8_t* mapping,
+					int nbr_stride, const int32_t* nbrs, int num_threads,
+					int32_t* labels)
+{
+	if (num_atoms < 0 || nbr_stride < 0)
+		return PTM_PLANAR_INVALID_ARGUMENT;
+
+	if (num_atoms > 0 && (types == NULL || q == NULL || mapping == NULL || nbrs == NULL || labels == NULL))
+		return PTM_PLANAR_INVALID_ARGUMENT;
+
+	defectinput_t in = {num_atoms, types, q, mapping, nbr_stride, nbrs};
+	num_threads = num_worker_threads(num_threads, num_atoms, 4096);
+	parallel_ranges(num_threads, num_atoms, [&](int64_t begin, int64_t end) {
+		for (int64_t i=begin;i<end;i++)
+			labels[i] = classify_atom(&in, i);
+	});
+
+	return PTM_NO_ERROR;
+}
+
@@ -0,0 +1,38 @@
+#ifndef PLANAR_DEFECTS_H
+#define PLANAR_DEFECTS_H
+
+#include <stdint.h>
+
+//------------------------------------
+//    definitions
+//------------------------------------
+#define PTM_PLANAR_INVALID_ARGUMENT	-1
+
+//planar defect labels
+#define PTM_PLANAR_NONE		0	//not an hcp atom
+#define PTM_PLANAR_OTHER	1	//hcp atom outside any recognised fault, e.g. bulk hcp, thicker faults and partial dislocation cores
+#define PTM_PLANAR_ISF		2	//intrinsic stacking fault: two adjacent hcp layers
+#define PTM_PLANAR_ESF		3	//extrinsic stacking fault: two hcp layers separated by one fcc layer
+#define PTM_PLANAR_TWIN		4	//coherent twin boundary: a single hcp layer
+
+//------------------------------------
+//    planar defect classification
+//------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Labels the hcp atoms of fcc crystals by the stacking of the {111} layers around them.  The layers above and below each hcp atom
+//are its mapped out-of-plane neighbours, and the layers beyond those are reached through the neighbours' own mappings and
+//orientations, so no positions are needed.  A layer counts as hcp or fcc when most of its atoms are.
+//types, q and mapping are the outputs of ptm_index_batch for the neighbour list nbrs (num_atoms x nbr_stride atom indices).
+int ptm_classify_planar_defects(	int num_atoms, const int32_t* types, const double* q, const int8_t* mapping,
+					int nbr_stride, const int32_t* nbrs, int num_threads,	//inputs
+					int32_t* labels);					//output
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
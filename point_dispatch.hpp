@@ -0,0 +1,18 @@
+#ifndef POINT_DISPATCH_HPP
+#define POINT_DISPATCH_HPP
+
+//Kernels over the points of a neighbourhood are templated on the number of points N.  N > 0 fixes it at compile time so that
+//the per-point loops can be unrolled; N = 0 is the generic version, which takes the number of points at run time.
+//DISPATCH_NUM_POINTS calls kernel<N>(...) for the 7, 13 and 15 point structures (sc; fcc, hcp and ico; bcc), and
+//kernel<0>(...) otherwise.
+#define DISPATCH_NUM_POINTS(num_points, kernel, ...)					\
+	switch (num_points)								\
+	{										\
+		case 7:		kernel<7>(__VA_ARGS__);		break;			\
+		case 13:	kernel<13>(__VA_ARGS__);	break;			\
+		case 15:	kernel<15>(__VA_ARGS__);	break;			\
+		default:	kernel<0>(__VA_ARGS__);		break;			\
+	}
+
+#endif
+
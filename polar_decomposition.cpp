@@ -81,11 +81,16 @@
  *	2012/07/26	  minor changes to comments and main.c, more info (v.1.4)
  *
  *      2016/05/29        QCP method adapted for polar decomposition of a 3x3 matrix.  For use in Polyhedral Template Matching.
+ *      2026/10/18        Added polar_decompositions_3x3(), which decomposes matrices in groups of POLAR_LANES.
  *  
  ******************************************************************************/
 
 #include <cstdbool>
 #include <cmath>
+#include "polar_decomposition.hpp"
+
+//matrices decomposed together by polar_decompositions_3x3
+#define POLAR_LANES 8
 
 
 static void matmul(double* A, double* x, double* b)
@@ -306,3 +311,185 @@ int polar_decomposition_3x3(double* _A, bool right_sided, double* U, double* P)
 	return !too_small;
 }
 
+
+//Decomposes a group of up to POLAR_LANES matrices with the arithmetic of polar_decomposition_3x3, one matrix per lane, so that
+//the compiler can vectorise across the group.  Newton-Raphson runs until every lane has converged, with converged lanes
+//left unchanged, and lanes needing another column of the adjoint matrix are redone by polar_decomposition_3x3.
+static int polar_decomposition_lanes(int num, const double* _A, bool right_sided, double* _U, double* _P)
+{
+	const double evecprec = 1e-6;
+	const double evalprec = 1e-11;
+
+	double A[9][POLAR_LANES], U[9][POLAR_LANES], C0[POLAR_LANES], C1[POLAR_LANES], C2[POLAR_LANES];
+	double x[POLAR_LANES], sign[POLAR_LANES], q[4][POLAR_LANES];
+	bool active[POLAR_LANES], fallback[POLAR_LANES];
+
+	for (int l=0;l<POLAR_LANES;l++)
+	{
+		//pad a partial group with copies of its first matrix
+		const double* M = &_A[9 * (l < num ? l : 0)];
+		double det = M[0] * (M[4]*M[8] - M[5]*M[7]) - M[1] * (M[3]*M[8] - M[5]*M[6]) + M[2] * (M[3]*M[7] - M[4]*M[6]);
+		sign[l] = det < 0 ? -1 : 1;
+		for (int i=0;i<9;i++)
+			A[i][l] = det < 0 ? -M[i] : M[i];
+	}
+
+	for (int l=0;l<POLAR_LANES;l++)
+	{
+		double	Sxx = A[0][l], Sxy = A[1][l], Sxz = A[2][l],
+			Syx = A[3][l], Syy = A[4][l], Syz = A[5][l],
+			Szx = A[6][l], Szy = A[7][l], Szz = A[8][l];
+
+		double	Sxx2 = Sxx * Sxx, Syy2 = Syy * Syy, Szz2 = Szz * Szz,
+			Sxy2 = Sxy * Sxy, Syz2 = Syz * Syz, Sxz2 = Sxz * Sxz,
+			Syx2 = Syx * Syx, Szy2 = Szy * Szy, Szx2 = Szx * Szx;
+
+		double SyzSzymSyySzz2 = 2.0*(Syz*Szy - Syy*Szz);
+		double Sxx2Syy2Szz2Syz2Szy2 = Syy2 + Szz2 - Sxx2 + Syz2 + Szy2;
+		double SxzpSzx = Sxz + Szx;
+		double SyzpSzy = Syz + Szy;
+		double SxypSyx = Sxy + Syx;
+		double SyzmSzy = Syz - Szy;
+		double SxzmSzx = Sxz - Szx;
+		double SxymSyx = Sxy - Syx;
+		double SxxpSyy = Sxx + Syy;
+		double SxxmSyy = Sxx - Syy;
+		double Sxy2Sxz2Syx2Szx2 = Sxy2 + Sxz2 - Syx2 - Szx2;
+
+		C0[l] = Sxy2Sxz2Syx2Szx2 * Sxy2Sxz2Syx2Szx2
+			 + (Sxx2Syy2Szz2Syz2Szy2 + SyzSzymSyySzz2) * (Sxx2Syy2Szz2Syz2Szy2 - SyzSzymSyySzz2)
+			 + (-(SxzpSzx)*(SyzmSzy)+(SxymSyx)*(SxxmSyy-Szz)) * (-(SxzmSzx)*(SyzpSzy)+(SxymSyx)*(SxxmSyy+Szz))
+			 + (-(SxzpSzx)*(SyzpSzy)-(SxypSyx)*(SxxpSyy-Szz)) * (-(SxzmSzx)*(SyzmSzy)-(SxypSyx)*(SxxpSyy+Szz))
+			 + (+(SxypSyx)*(SyzpSzy)+(SxzpSzx)*(SxxmSyy+Szz)) * (-(SxymSyx)*(SyzmSzy)+(SxzpSzx)*(SxxpSyy+Szz))
+			 + (+(SxypSyx)*(SyzmSzy)+(SxzmSzx)*(SxxmSyy-Szz)) * (-(SxymSyx)*(SyzpSzy)+(SxzmSzx)*(SxxpSyy-Szz));
+
+		C1[l] = 8.0 * (Sxx*Syz*Szy + Syy*Szx*Sxz + Szz*Sxy*Syx - Sxx*Syy*Szz - Syz*Szx*Sxy - Szy*Syx*Sxz);
+
+		C2[l] = -2.0 * (Sxx2 + Syy2 + Szz2 + Sxy2 + Syx2 + Sxz2 + Szx2 + Syz2 + Szy2);
+
+		double fnorm_squared = 0.0;
+		for (int i=0;i<9;i++)
+			fnorm_squared += A[i][l]*A[i][l];
+
+		x[l] = sqrt(3 * fnorm_squared);
+		active[l] = x[l] > evalprec;
+		x[l] = active[l] ? x[l] : 0.0;
+	}
+
+	//Newton-Raphson
+	for (int it=0;it<50;it++)
+	{
+		int num_active = 0;
+		for (int l=0;l<POLAR_LANES;l++)
+		{
+			double oldg = x[l];
+			double x2 = oldg*oldg;
+			double b = (x2 + C2[l])*oldg;
+			double a = b + C1[l];
+			double delta = ((a * oldg + C0[l]) / (2 * x2 * oldg + b + a));
+			double next = oldg - delta;
+			x[l] = active[l] ? next : oldg;
+			active[l] = active[l] && !(fabs(next - oldg) < fabs(evalprec * next));
+			num_active += active[l];
+		}
+
+		if (num_active == 0)
+			break;
+	}
+
+	for (int l=0;l<POLAR_LANES;l++)
+	{
+		double mxEigenV = x[l];
+		double	Sxx = A[0][l], Sxy = A[1][l], Sxz = A[2][l],
+			Syx = A[3][l], Syy = A[4][l], Syz = A[5][l],
+			Szx = A[6][l], Szy = A[7][l], Szz = A[8][l];
+
+		double SxzpSzx = Sxz + Szx;
+		double SyzpSzy = Syz + Szy;
+		double SxypSyx = Sxy + Syx;
+		double SyzmSzy = Syz - Szy;
+		double SxzmSzx = Sxz - Szx;
+		double SxymSyx = Sxy - Syx;
+		double SxxpSyy = Sxx + Syy;
+		double SxxmSyy = Sxx - Syy;
+
+		double a21 = SyzmSzy;
+		double a22 = SxxmSyy - Szz  -mxEigenV;
+		double a23 = SxypSyx;
+		double a24 = SxzpSzx;
+
+		double a31 = -SxzmSzx;
+		double a32 = a23;
+		double a33 = Syy - Sxx - Szz - mxEigenV;
+		double a34 = SyzpSzy;
+
+		double a41 = SxymSyx;
+		double a42 = a24;
+		double a43 = a34;
+		double a44 = Szz - SxxpSyy - mxEigenV;
+
+		double a3344_4334 = a33 * a44 - a43 * a34;
+		double a3244_4234 = a32 * a44 - a42 * a34;
+		double a3243_4233 = a32 * a43 - a42 * a33;
+		double a3143_4133 = a31 * a43 - a41 * a33;
+		double a3144_4134 = a31 * a44 - a41 * a34;
+		double a3142_4132 = a31 * a42 - a41 * a32;
+
+		double q1 =  a22*a3344_4334-a23*a3244_4234+a24*a3243_4233;
+		double q2 = -a21*a3344_4334+a23*a3144_4134-a24*a3143_4133;
+		double q3 =  a21*a3244_4234-a22*a3144_4134+a24*a3142_4132;
+		double q4 = -a21*a3243_4233+a22*a3143_4133-a23*a3142_4132;
+
+		double qsqr = q1 * q1 + q2 * q2 + q3 * q3 + q4 * q4;
+		fallback[l] = qsqr < evecprec;
+
+		double normq = sqrt(qsqr);
+		q[0][l] = -q1 / normq;
+		q[1][l] = q2 / normq;
+		q[2][l] = q3 / normq;
+		q[3][l] = q4 / normq;
+	}
+
+	for (int l=0;l<POLAR_LANES;l++)
+	{
+		double u[9], qq[4] = {q[0][l], q[1][l], q[2][l], q[3][l]};
+		quaternion_to_rotation_matrix(qq, u);
+		for (int i=0;i<9;i++)
+			U[i][l] = sign[l] * u[i];
+	}
+
+	int num_fallback = 0;
+	for (int l=0;l<num;l++)
+	{
+		double* Ul = &_U[9 * l];
+		double* Pl = &_P[9 * l];
+		if (fallback[l])
+		{
+			num_fallback += !polar_decomposition_3x3((double*)&_A[9 * l], right_sided, Ul, Pl);
+			continue;
+		}
+
+		for (int i=0;i<9;i++)
+			Ul[i] = U[i][l];
+
+		double invU[9] = {Ul[0], Ul[3], Ul[6], Ul[1], Ul[4], Ul[7], Ul[2], Ul[5], Ul[8]};
+		if (right_sided)
+			matmul(invU, (double*)&_A[9 * l], Pl);
+		else
+			matmul((double*)&_A[9 * l], invU, Pl);
+	}
+
+	return num_fallback;
+}
+
+int polar_decompositions_3x3(int num, const double* A, bool right_sided, double* U, double* P)
+{
+	int num_fallback = 0;
+	for (int i=0;i<num;i+=POLAR_LANES)
+	{
+		int n = num - i < POLAR_LANES ? num - i : POLAR_LANES;
+		num_fallback += polar_decomposition_lanes(n, &A[9 * i], right_sided, &U[9 * i], &P[9 * i]);
+	}
+
+	return num_fallback;
+}
@@ -3,5 +3,8 @@
 
 int polar_decomposition_3x3(double* A, bool right_sided, double* U, double* P);
 
+//decomposes num matrices (9 doubles each) as above.  Returns the number for which no rotation could be found.
+int polar_decompositions_3x3(int num, const double* A, bool right_sided, double* U, double* P);
+
 #endif
 
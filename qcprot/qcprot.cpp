@@ -86,6 +86,7 @@
  *	2012/07/26	  minor changes to comments and main.c, more info (v.1.4)
  *
  *      2016/02/20        modified for use in Polyhedral Template Matching.  InnerProduct function now takes permutation array.
+ *      2026/10/18        minScore now rejects alignments whose rmsd exceeds it, without calculating the rotation.
  *  
  ******************************************************************************/
 #include <cstdlib>
@@ -141,6 +142,10 @@ int FastCalcRMSDAndRotation(double *q, double *A, double *rmsd, double E0, int l
 		 + (+(SxypSyx)*(SyzpSzy)+(SxzpSzx)*(SxxmSyy+Szz)) * (-(SxymSyx)*(SyzmSzy)+(SxzpSzx)*(SxxpSyy+Szz))
 		 + (+(SxypSyx)*(SyzmSzy)+(SxzmSzx)*(SxxmSyy-Szz)) * (-(SxymSyx)*(SyzpSzy)+(SxzmSzx)*(SxxpSyy-Szz));
 
+	//The Newton-Raphson iterates decrease monotonically towards the largest eigenvalue, so an alignment can be
+	//rejected as soon as an iterate falls below the eigenvalue which corresponds to an rmsd of minScore.
+	double minEigenV = minScore > 0 ? E0 - minScore * minScore * len / 2 : -INFINITY;
+
 	//Newton-Raphson
 	mxEigenV = E0;
 	int i = 0;
@@ -155,6 +160,9 @@ int FastCalcRMSDAndRotation(double *q, double *A, double *rmsd, double E0, int l
 		//printf("\n diff[%3d]: %16g %16g %16g", i, mxEigenV - oldg, evalprec*mxEigenV, mxEigenV);
 		if (fabs(mxEigenV - oldg) < fabs(evalprec*mxEigenV))
 			break;
+
+		if (mxEigenV < minEigenV)
+			break;
 	}
 
 	//if (i == 50) 
@@ -165,9 +173,9 @@ int FastCalcRMSDAndRotation(double *q, double *A, double *rmsd, double E0, int l
 	(*rmsd) = rms;
 	//printf("\n\n %16g %16g %16g \n", rms, E0, 2.0 * (E0 - mxEigenV)/len);
 
-	if (minScore > 0) 
-		if (rms < minScore)
-			return -1; // Don't bother with rotation. 
+	if (minScore > 0)
+		if (rms > minScore)
+			return -1; // Don't bother with rotation.
 
 	a11 = SxxpSyy + Szz - mxEigenV;
 	a12 = SyzmSzy;
@@ -264,31 +272,3 @@ int FastCalcRMSDAndRotation(double *q, double *A, double *rmsd, double E0, int l
 	return 1;
 }
 
-void InnerProduct(double *A, int num, const double (*coords1)[3], double (*coords2)[3], int8_t* permutation)
-{
-	A[0] = A[1] = A[2] = A[3] = A[4] = A[5] = A[6] = A[7] = A[8] = 0.0;
-
-	for (int i = 0; i < num; ++i)
-	{
-		double x1 = coords1[i][0];
-		double y1 = coords1[i][1];
-		double z1 = coords1[i][2];
-
-		double x2 = coords2[permutation[i]][0];
-		double y2 = coords2[permutation[i]][1];
-		double z2 = coords2[permutation[i]][2];
-
-		A[0] += x1 * x2;
-		A[1] += x1 * y2;
-		A[2] += x1 * z2;
-
-		A[3] += y1 * x2;
-		A[4] += y1 * y2;
-		A[5] += y1 * z2;
-
-		A[6] += z1 * x2;
-		A[7] += z1 * y2;
-		A[8] += z1 * z2;  
-	}
-}
-
@@ -79,8 +79,44 @@
 #define QCPROT_HPP
 
 #include <stdint.h>
+
+//minScore > 0 returns -1, without calculating the rotation, when the rmsd is larger than minScore
 int FastCalcRMSDAndRotation(double *q, double *A, double *rmsd, double E0, int len, double minScore, double* rot);
-void InnerProduct(double *A, int num, const double (*coords1)[3], double (*coords2)[3], int8_t* permutation);
+
+//templated on the number of points like the kernels of point_dispatch.hpp; N = 0 uses num
+template <int N>
+void InnerProduct(double *A, int num, const double (*coords1)[3], const double (*coords2)[3])
+{
+	const int n = N > 0 ? N : num;
+	double a0 = 0, a1 = 0, a2 = 0, a3 = 0, a4 = 0, a5 = 0, a6 = 0, a7 = 0, a8 = 0;
+
+	for (int i = 0; i < n; ++i)
+	{
+		double x1 = coords1[i][0];
+		double y1 = coords1[i][1];
+		double z1 = coords1[i][2];
+
+		double x2 = coords2[i][0];
+		double y2 = coords2[i][1];
+		double z2 = coords2[i][2];
+
+		a0 += x1 * x2;
+		a1 += x1 * y2;
+		a2 += x1 * z2;
+
+		a3 += y1 * x2;
+		a4 += y1 * y2;
+		a5 += y1 * z2;
+
+		a6 += z1 * x2;
+		a7 += z1 * y2;
+		a8 += z1 * z2;
+	}
+
+	A[0] = a0; A[1] = a1; A[2] = a2;
+	A[3] = a3; A[4] = a4; A[5] = a5;
+	A[6] = a6; A[7] = a7; A[8] = a8;
+}
 
 #endif
 
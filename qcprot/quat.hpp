@@ -5,7 +5,13 @@ int rotate_quaternion_into_cubic_fundamental_zone(double* q);
 int rotate_quaternion_into_icosahedral_fundamental_zone(double* q);
 int rotate_quaternion_into_hcp_fundamental_zone(double* q);
 
+//array versions: q holds num quaternions, 4 doubles each.  bi receives the generator index of each, if not NULL.
+void rotate_quaternions_into_cubic_fundamental_zone(int num, double* q, int* bi);
+void rotate_quaternions_into_icosahedral_fundamental_zone(int num, double* q, int* bi);
+void rotate_quaternions_into_hcp_fundamental_zone(int num, double* q, int* bi);
+
 void normalize_quaternion(double* q);
+void quat_rot(double* r, double* a, double* b);		//b = r * a
 void quaternion_to_rotation_matrix(double* q, double* U);
 void rotation_matrix_to_quaternion(double* u, double* q);
 double quat_dot(double* a, double* b);
@@ -19,5 +25,10 @@ double quat_disorientation_hcp(double* q0, double* q1);
 double quat_quick_disorientation_icosahedral(double* q0, double* q1);
 double quat_disorientation_icosahedral(double* q0, double* q1);
 
+//disorientation angles of num pairs of quaternions (4 doubles each), as from the functions above
+void quat_disorientations_cubic(int num, const double* q0, const double* q1, double* angles);
+void quat_disorientations_hcp(int num, const double* q0, const double* q1, double* angles);
+void quat_disorientations_icosahedral(int num, const double* q0, const double* q1, double* angles);
+
 #endif
 
@@ -32,14 +32,28 @@ done:
 #include <cmath>
 #include <cstdint>
 #include <cstdbool>
+#include <vector>
+#include <thread>
 #include "index_ptm.h"
+#include "index_batch.h"
+#include "disorientation.h"
+#include "grain_segmentation.h"
+#include "planar_defects.h"
+#include "neighbour_list.h"
 #include "normalize_vertices.hpp"
+#include "canonical.hpp"
+#include "convex_hull_incremental.hpp"
+#include "graph_tables.hpp"
 #include "qcprot/quat.hpp"
+#include "polar_decomposition.hpp"
+#include "deformation_gradient.hpp"
 
 
 #define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
 #define MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
 
+#define MAX_NBRS 18
+
 #define RADIANS(x) (2.0 * M_PI * (x) / 360.0)
 #define DEGREES(x) (360 * (x) / (2.0 * M_PI))
 
@@ -373,6 +387,169 @@ static double mapped_neighbour_rmsd(int num, double scale, double* A, double (*i
 	return sqrt(fabs(acc / num));
 }
 
+static int build_fcc_crystal(int n, double lattice_constant, double* positions)
+{
+	const double basis[4][3] = {{0, 0, 0}, {0.5, 0.5, 0}, {0.5, 0, 0.5}, {0, 0.5, 0.5}};
+
+	int num_atoms = 0;
+	for (int i=0;i<n;i++)
+		for (int j=0;j<n;j++)
+			for (int k=0;k<n;k++)
+				for (int b=0;b<4;b++)
+				{
+					double* p = &positions[3 * num_atoms++];
+					p[0] = lattice_constant * (i + basis[b][0]) + 0.01 * sin(num_atoms);
+					p[1] = lattice_constant * (j + basis[b][1]) + 0.01 * cos(num_atoms);
+					p[2] = lattice_constant * (k + basis[b][2]) + 0.01 * sin(2 * num_atoms);
+				}
+
+	return num_atoms;
+}
+
+static void find_nearest_neighbours(int num_atoms, double* positions, double* box, int num_nbrs, int32_t* nbrs)
+{
+	for (int i=0;i<num_atoms;i++)
+	{
+		double dist[MAX_NBRS];
+		int found = 0;
+		for (int j=0;j<num_atoms;j++)
+		{
+			if (j == i)
+				continue;
+
+			double d = 0;
+			for (int l=0;l<3;l++)
+			{
+				double delta = positions[3*j+l] - positions[3*i+l];
+				if (box != NULL)
+					delta -= box[l] * round(delta / box[l]);
+				d += delta * delta;
+			}
+
+			//insertion into sorted list
+			int k = found < num_nbrs ? found++ : num_nbrs;
+			for (;k>0 && dist[k-1] > d;k--)
+			{
+				if (k < num_nbrs)
+				{
+					dist[k] = dist[k-1];
+					nbrs[i * num_nbrs + k] = nbrs[i * num_nbrs + k - 1];
+				}
+			}
+
+			if (k < num_nbrs)
+			{
+				dist[k] = d;
+				nbrs[i * num_nbrs + k] = j;
+			}
+		}
+	}
+}
+
+//The incremental convex hull as it was before facet planes were stored in structure-of-arrays form: visible facets are
+//swap-removed and horizon edges are found from per-edge visibility flags.  Used to check that the rewrite finds the same facets in the same order.
+typedef struct
+{
+	int8_t facets[MAXF][3];
+	double plane_normal[MAXF][3];
+	bool processed[15];
+	double barycentre[3];
+	int num_facets;
+	int num_prev;
+	bool ok;
+} referencehull_t;
+
+static double reference_plane_distance(const double* w, const double* plane_point, const double* plane_normal)
+{
+	return	  plane_normal[0] * (plane_point[0] - w[0])
+		+ plane_normal[1] * (plane_point[1] - w[1])
+		+ plane_normal[2] * (plane_point[2] - w[2]);
+}
+
+//initial_vertices are those chosen by get_convex_hull, whose initial simplex code was not changed
+static int reference_convex_hull(int num_points, const double (*points)[3], int num_expected_facets, const int* initial_vertices, referencehull_t* ch)
+{
+	const int VISIBLE = 1, INVISIBLE = 2, BOTH = 3;
+	int num_prev = ch->num_prev;
+	ch->num_prev = num_points;
+	if (!ch->ok)
+	{
+		memset(ch->processed, 0, sizeof(ch->processed));
+		memset(ch->barycentre, 0, sizeof(ch->barycentre));
+		for (int i=0;i<4;i++)
+		{
+			ch->processed[initial_vertices[i]] = true;
+			for (int j=0;j<3;j++)
+				ch->barycentre[j] += points[initial_vertices[i]][j];
+		}
+		for (int j=0;j<3;j++)
+			ch->barycentre[j] /= 4;
+
+		const int v[4][3] = {{0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}};
+		for (int j=0;j<4;j++)
+			add_facet(points, initial_vertices[v[j][0]], initial_vertices[v[j][1]], initial_vertices[v[j][2]], ch->facets[j], ch->plane_normal[j], ch->barycentre);
+		ch->num_facets = 4;
+		num_prev = 0;
+	}
+
+	for (int i=num_prev;i<num_points;i++)
+	{
+		if (ch->processed[i])
+			continue;
+		ch->processed[i] = true;
+
+		int num_to_add = 0;
+		int8_t to_add[3 * MAXF][3];
+		int8_t edge_visible[15][15];
+		memset(edge_visible, 0, sizeof(edge_visible));
+		for (int j=0;j<ch->num_facets;j++)
+		{
+			int a = ch->facets[j][0], b = ch->facets[j][1], c = ch->facets[j][2];
+			int flag = reference_plane_distance(points[i], points[a], ch->plane_normal[j]) > 1E-8 ? VISIBLE : INVISIBLE;
+			int u = edge_visible[a][b] |= flag;	edge_visible[b][a] |= flag;
+			int v = edge_visible[b][c] |= flag;	edge_visible[c][b] |= flag;
+			int w = edge_visible[c][a] |= flag;	edge_visible[a][c] |= flag;
+
+			if (flag == VISIBLE)
+			{
+				memcpy(ch->facets[j], ch->facets[ch->num_facets - 1], 3 * sizeof(int8_t));
+				memcpy(ch->plane_normal[j], ch->plane_normal[ch->num_facets - 1], 3 * sizeof(double));
+				ch->num_facets--;
+				j--;
+			}
+
+			int edges[3][3] = {{u, a, b}, {v, b, c}, {w, c, a}};
+			for (int k=0;k<3;k++)
+			{
+				if (edges[k][0] != BOTH)
+					continue;
+				to_add[num_to_add][0] = i;
+				to_add[num_to_add][1] = edges[k][1];
+				to_add[num_to_add][2] = edges[k][2];
+				num_to_add++;
+			}
+		}
+
+		for (int j=0;j<num_to_add;j++)
+		{
+			if (ch->num_facets >= MAXF)
+				return -4;
+
+			add_facet(points, to_add[j][0], to_add[j][1], to_add[j][2], ch->facets[ch->num_facets], ch->plane_normal[ch->num_facets], ch->barycentre);
+			ch->num_facets++;
+		}
+	}
+
+	if (ch->num_facets != num_expected_facets)
+		return -5;
+
+	for (int i=0;i<ch->num_facets;i++)
+		if (ch->facets[i][0] == 0 || ch->facets[i][1] == 0 || ch->facets[i][2] == 0)
+			return -6;
+
+	return 0;
+}
+
 uint64_t run_tests()
 {
 	int ret = 0;
@@ -701,6 +878,1523 @@ exit(3);*/
 		}
 	}
 
+	//warm start from the previous frame's result
+	for (int it = 0;it<num_structures;it++)
+	{
+		structdata_t* s = &structdata[it];
+
+		double qrot[4] = {0.987070, 0.020780, -0.031171, 0.155853}, rot[9];
+		normalize_quaternion(qrot);
+		quaternion_to_rotation_matrix(qrot, rot);
+
+		double points[15][3], moved[15][3];
+		for (int i=0;i<s->num_points;i++)
+		{
+			matvec(rot, (double*)s->points[i], points[i]);
+			for (int j=0;j<3;j++)
+				moved[i][j] = points[i][j] + 0.01 * sin(3 * i + j);
+		}
+
+		int32_t type, prev_type;
+		double scale, rmsd, q[4];
+		int8_t prev_mapping[15], bad_mapping[15];
+		int32_t ids[16];
+		for (int i=0;i<16;i++)
+			ids[i] = i;
+		ret = ptm_index(local_handle, s->num_points, points[0], NULL, s->check, false, &prev_type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, prev_mapping, NULL, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("indexing failed", ret);
+
+		int32_t ref_type;
+		double ref_scale, ref_rmsd, ref_q[4];
+		int8_t ref_mapping[15];
+		ret = ptm_index(local_handle, s->num_points, moved[0], NULL, s->check, false, &ref_type, NULL, &ref_scale, &ref_rmsd, ref_q, NULL, NULL, NULL, NULL, ref_mapping, NULL, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("indexing failed", ret);
+
+		//accepted warm start must reproduce the full search
+		int8_t mapping[15];
+		ret = ptm_index_warm_start(local_handle, s->num_points, moved[0], NULL, s->check, false, prev_type, prev_mapping, ids, ids, 0.1, &type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, mapping, NULL, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("indexing failed", ret);
+
+		if (type != ref_type || fabs(rmsd - ref_rmsd) > tolerance || fabs(scale - ref_scale) > tolerance)
+			CLEANUP("failed on warm start", -1);
+
+		if (quat_misorientation(q, ref_q) > tolerance)
+			CLEANUP("failed on warm start orientation", -1);
+
+		if (memcmp(mapping, ref_mapping, s->num_points * sizeof(int8_t)) != 0)
+			CLEANUP("failed on warm start mapping", -1);
+
+		//a stale correspondence must fall back to the full search
+		memcpy(bad_mapping, prev_mapping, sizeof(bad_mapping));
+		bad_mapping[1] = prev_mapping[2];
+		bad_mapping[2] = prev_mapping[1];
+		ret = ptm_index_warm_start(local_handle, s->num_points, moved[0], NULL, s->check, false, prev_type, bad_mapping, ids, ids, 0.1, &type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, mapping, NULL, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("indexing failed", ret);
+
+		if (type != ref_type || fabs(rmsd - ref_rmsd) > tolerance)
+			CLEANUP("failed on warm start fallback", -1);
+
+		//The correspondence follows the neighbours when their order is reversed.  The neighbours are displaced too far
+		//for the full search to be reliable, so a generous rmsd limit shows that the previous correspondence was used.
+		double reversed[15][3];
+		int32_t reversed_ids[15];
+		memcpy(reversed[0], moved[0], 3 * sizeof(double));
+		for (int k=1;k<s->num_points;k++)
+		{
+			for (int j=0;j<3;j++)
+				reversed[k][j] = points[s->num_points - k][j] + 0.2 * sin(5 * k + j);
+			reversed_ids[k - 1] = ids[s->num_points - k - 1];
+		}
+
+		ret = ptm_index_warm_start(local_handle, s->num_points, reversed[0], NULL, s->check, false, prev_type, prev_mapping, ids, reversed_ids, 10, &type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, mapping, NULL, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("indexing failed", ret);
+
+		if (type != prev_type)
+			CLEANUP("failed on reordered warm start", -1);
+
+		for (int k=1;k<=ptm_num_nbrs[type];k++)
+			if (reversed_ids[mapping[k] - 1] != ids[prev_mapping[k] - 1])
+				CLEANUP("failed on reordered warm start mapping", -1);
+
+		//A changed neighbour set falls back to the full search, even if all previously mapped neighbours are still
+		//present: here an unmapped distant neighbour is replaced by an atom close to the centre, listed first.
+		double extended[16][3], replaced[16][3];
+		int32_t extended_ids[15], replaced_ids[15];
+		memcpy(extended, points, s->num_points * 3 * sizeof(double));
+		memcpy(extended_ids, ids, sizeof(extended_ids));
+		for (int j=0;j<3;j++)
+			extended[s->num_points][j] = 10;
+		extended_ids[s->num_points - 1] = 99;
+
+		memcpy(replaced[0], moved[0], 3 * sizeof(double));
+		memcpy(replaced[2], moved[1], (s->num_points - 1) * 3 * sizeof(double));
+		replaced_ids[0] = 100;
+		memcpy(&replaced_ids[1], ids, (s->num_points - 1) * sizeof(int32_t));
+		for (int j=0;j<3;j++)
+			replaced[1][j] = 0.3 * points[1][j];
+
+		int8_t extended_mapping[15];
+		ret = ptm_index(local_handle, s->num_points + 1, extended[0], NULL, s->check, false, &prev_type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, extended_mapping, NULL, NULL);
+		ret |= ptm_index(local_handle, s->num_points + 1, replaced[0], NULL, s->check, false, &ref_type, NULL, &ref_scale, &ref_rmsd, ref_q, NULL, NULL, NULL, NULL, ref_mapping, NULL, NULL);
+		ret |= ptm_index_warm_start(local_handle, s->num_points + 1, replaced[0], NULL, s->check, false, prev_type, extended_mapping, extended_ids, replaced_ids, 10, &type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, mapping, NULL, NULL);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("indexing failed", ret);
+
+		if (type != ref_type || (type != PTM_MATCH_NONE && fabs(rmsd - ref_rmsd) > tolerance))
+			CLEANUP("failed on warm start with a changed neighbour set", -1);
+
+		num_tests++;
+	}
+
+	//batch indexing, displacement-gated skipping and warm starts
+	{
+		const int n = 5, num_nbrs = MAX_NBRS;
+		int max_atoms = 4 * n * n * n;
+		double* positions = (double*)malloc(3 * max_atoms * sizeof(double));
+		int32_t* nbrs = (int32_t*)malloc(max_atoms * num_nbrs * sizeof(int32_t));
+		int32_t* types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+		double* rmsds = (double*)malloc(max_atoms * sizeof(double));
+		double* quats = (double*)malloc(4 * max_atoms * sizeof(double));
+		int8_t* mappings = (int8_t*)malloc(PTM_MAX_POINTS * max_atoms * sizeof(int8_t));
+
+		int num_atoms = build_fcc_crystal(n, 2.0, positions);
+		find_nearest_neighbours(num_atoms, positions, NULL, num_nbrs, nbrs);
+
+		ptm_batch_output_t output;
+		memset(&output, 0, sizeof(ptm_batch_output_t));
+		output.type = types;
+		output.rmsd = rmsds;
+		output.q = quats;
+		output.mapping = mappings;
+
+		ptm_batch_config_t config;
+		memset(&config, 0, sizeof(ptm_batch_config_t));
+		config.flags = PTM_CHECK_ALL;
+		config.topological_ordering = true;
+		config.skip_tolerance = 0.01;
+		config.summarize = true;
+		config.rmsd_range[1] = 0.05;
+		config.lattice_constant_range[0] = 1.9;
+		config.lattice_constant_range[1] = 2.1;
+
+		ptm_batch_stats_t stats;
+		ptm_batch_handle_t batch_handle = ptm_initialize_batch(4);
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+
+		if (stats.num_skipped != 0)
+			CLEANUP("failed on batch skip count", -1);
+
+		//in-kernel summary matches the per-atom outputs
+		{
+			int64_t counts[PTM_MATCH_SC + 1] = {0}, rmsd_bins[PTM_BATCH_HISTOGRAM_BINS] = {0};
+			for (int i=0;i<num_atoms;i++)
+			{
+				counts[types[i]]++;
+				if (types[i] == PTM_MATCH_FCC)
+					rmsd_bins[MIN(PTM_BATCH_HISTOGRAM_BINS - 1, (int)(rmsds[i] / 0.05 * PTM_BATCH_HISTOGRAM_BINS))]++;
+			}
+
+			int64_t num_scaled = 0, num_alloyed = 0, num_lattice = 0;
+			for (int b=0;b<PTM_BATCH_HISTOGRAM_BINS;b++)
+			{
+				if (stats.rmsd_histogram.counts[PTM_MATCH_FCC][b] != rmsd_bins[b])
+					ret = -1;
+				num_scaled += stats.scale_histogram.counts[PTM_MATCH_FCC][b];
+				num_lattice += stats.lattice_constant_histogram.counts[PTM_MATCH_FCC][b];
+			}
+
+			for (int j=0;j<=PTM_MATCH_SC;j++)
+				if (stats.structure_counts[j] != counts[j])
+					ret = -1;
+			for (int j=0;j<=PTM_ALLOY_B2;j++)
+				num_alloyed += stats.alloy_counts[j];
+
+			if (num_scaled != 0 || num_lattice != counts[PTM_MATCH_FCC] || num_alloyed != num_atoms || stats.alloy_counts[PTM_ALLOY_NONE] != num_atoms)
+				ret = -1;
+			if (stats.rmsd_histogram.max != 0.05 || stats.lattice_constant_histogram.min != 1.9)
+				ret = -1;
+			if (ret != 0)
+				CLEANUP("failed on batch summary", -1);
+		}
+
+		//compare with single-atom indexing
+		int num_fcc = 0;
+		for (int i=0;i<num_atoms && ret == 0;i++)
+		{
+			double points[MAX_NBRS + 1][3] = {{0}};
+			for (int k=0;k<num_nbrs;k++)
+				for (int j=0;j<3;j++)
+					points[k+1][j] = positions[3 * nbrs[i * num_nbrs + k] + j] - positions[3 * i + j];
+
+			int32_t type;
+			double scale, rmsd, q[4];
+			ptm_index(local_handle, num_nbrs + 1, points[0], NULL, PTM_CHECK_ALL, true, &type, NULL, &scale, &rmsd, q, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+			if (type != types[i] || (type != PTM_MATCH_NONE && rmsd != rmsds[i]))
+				ret = -1;
+			num_fcc += types[i] == PTM_MATCH_FCC;
+		}
+		if (ret != 0 || num_fcc < num_atoms / 2)
+			CLEANUP("failed on batch indexing", -1);
+
+		//spatial ordering only changes the order in which atoms are processed
+		{
+			int32_t* ordered_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			double* ordered_rmsds = (double*)malloc(max_atoms * sizeof(double));
+
+			ptm_batch_output_t ordered_output;
+			memset(&ordered_output, 0, sizeof(ptm_batch_output_t));
+			ordered_output.type = ordered_types;
+			ordered_output.rmsd = ordered_rmsds;
+
+			ptm_batch_config_t ordered_config = config;
+			ordered_config.spatial_ordering = true;
+
+			ptm_batch_handle_t ordered_handle = ptm_initialize_batch(3);
+			ret = ptm_index_batch(ordered_handle, &ordered_config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &ordered_output, NULL);
+			ptm_uninitialize_batch(ordered_handle);
+
+			for (int i=0;i<num_atoms && ret == 0;i++)
+				if (ordered_types[i] != types[i] || ordered_rmsds[i] != rmsds[i])
+					ret = -1;
+
+			free(ordered_types);
+			free(ordered_rmsds);
+			if (ret != 0)
+				CLEANUP("failed on batch spatial ordering", -1);
+		}
+
+		//NUMA-aware placement changes neither the results nor the number of atoms indexed
+		{
+			ptm_batch_handle_t numa_handle = ptm_initialize_batch(3);
+			int32_t* numa_types = (int32_t*)ptm_batch_allocate(numa_handle, num_atoms, sizeof(int32_t));
+			double* numa_rmsds = (double*)ptm_batch_allocate(numa_handle, num_atoms, sizeof(double));
+			for (int i=0;i<num_atoms && ret == 0;i++)
+				if (numa_types[i] != 0 || numa_rmsds[i] != 0)
+					ret = -1;
+
+			ptm_batch_output_t numa_output;
+			memset(&numa_output, 0, sizeof(ptm_batch_output_t));
+			numa_output.type = numa_types;
+			numa_output.rmsd = numa_rmsds;
+
+			ptm_batch_config_t numa_config = config;
+			numa_config.numa_aware = true;
+
+			ptm_batch_stats_t numa_stats;
+			ret |= ptm_index_batch(numa_handle, &numa_config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &numa_output, &numa_stats);
+			ptm_uninitialize_batch(numa_handle);
+
+			int64_t total = 0;
+			for (int n=0;n<numa_stats.num_nodes;n++)
+				total += numa_stats.node_num_atoms[n];
+			if (numa_stats.num_nodes < 1 || total != num_atoms)
+				ret = -1;
+
+			for (int i=0;i<num_atoms && ret == 0;i++)
+				if (numa_types[i] != types[i] || numa_rmsds[i] != rmsds[i])
+					ret = -1;
+
+			free(numa_types);
+			free(numa_rmsds);
+			if (ret != 0)
+				CLEANUP("failed on NUMA-aware batch indexing", -1);
+		}
+
+		//KAM matches the disorientations between mapped neighbours, with and without orientation outputs and spatial ordering
+		{
+			const double threshold = 0.03;
+			double* noisy = (double*)malloc(3 * max_atoms * sizeof(double));
+			double* kams[2] = {(double*)malloc(max_atoms * sizeof(double)), (double*)malloc(max_atoms * sizeof(double))};
+			int32_t* kam_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			double* kam_quats = (double*)malloc(4 * max_atoms * sizeof(double));
+			int8_t* kam_mappings = (int8_t*)malloc(PTM_MAX_POINTS * max_atoms * sizeof(int8_t));
+			srand(13);
+			for (int i=0;i<3 * num_atoms;i++)
+				noisy[i] = positions[i] + 0.05 * (rand() / (double)RAND_MAX - 0.5);
+
+			for (int k=0;k<2;k++)
+			{
+				ptm_batch_output_t kam_output;
+				memset(&kam_output, 0, sizeof(ptm_batch_output_t));
+				kam_output.kam = kams[k];
+				if (k == 0)
+				{
+					kam_output.type = kam_types;
+					kam_output.q = kam_quats;
+					kam_output.mapping = kam_mappings;
+				}
+
+				ptm_batch_config_t kam_config = config;
+				kam_config.skip_tolerance = 0;
+				kam_config.spatial_ordering = k == 1;
+				kam_config.kam_threshold = threshold;
+
+				ptm_batch_handle_t kam_handle = ptm_initialize_batch(3);
+				ret |= ptm_index_batch(kam_handle, &kam_config, num_atoms, noisy, NULL, num_nbrs, num_nbrs, nbrs, &kam_output, NULL);
+				ptm_uninitialize_batch(kam_handle);
+			}
+
+			int num_counted = 0;
+			for (int i=0;i<num_atoms && ret == 0;i++)
+			{
+				double sum = 0;
+				int count = 0;
+				for (int k=1;k<=ptm_num_nbrs[kam_types[i]];k++)
+				{
+					int j = nbrs[i * num_nbrs + kam_mappings[i * PTM_MAX_POINTS + k] - 1];
+					if (kam_types[j] != kam_types[i])
+						continue;
+
+					double angle = kam_types[i] == PTM_MATCH_HCP ? quat_disorientation_hcp(&kam_quats[4 * i], &kam_quats[4 * j])
+										    : quat_disorientation_cubic(&kam_quats[4 * i], &kam_quats[4 * j]);
+					if (angle < threshold)
+					{
+						sum += angle;
+						count++;
+					}
+				}
+
+				for (int k=0;k<2;k++)
+				{
+					if (count == 0 && !std::isnan(kams[k][i]))
+						ret = -1;
+					if (count > 0 && fabs(kams[k][i] - sum / count) > 1E-9)
+						ret = -1;
+				}
+				num_counted += count > 0;
+			}
+
+			free(noisy);
+			free(kams[0]);
+			free(kams[1]);
+			free(kam_types);
+			free(kam_quats);
+			free(kam_mappings);
+			if (ret != 0 || num_counted < num_atoms / 2)
+				CLEANUP("failed on batch KAM", -1);
+		}
+
+		//strain outputs of a homogeneously deformed crystal, relative to the undeformed lattice constant
+		{
+			const double F0[9] = {1.02, 0.01, 0, 0.01, 0.99, 0.005, 0, 0.005, 1.0};
+			const double basis[4][3] = {{0, 0, 0}, {0.5, 0.5, 0}, {0.5, 0, 0.5}, {0, 0.5, 0.5}};
+			double* deformed = (double*)malloc(3 * max_atoms * sizeof(double));
+			int32_t* strain_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			double* von_mises = (double*)malloc(max_atoms * sizeof(double));
+			double* volumetric = (double*)malloc(max_atoms * sizeof(double));
+			double* green_lagrange = (double*)malloc(9 * max_atoms * sizeof(double));
+			double* stretch = (double*)malloc(9 * max_atoms * sizeof(double));
+			double* rotation = (double*)malloc(9 * max_atoms * sizeof(double));
+			int32_t* deformed_nbrs = (int32_t*)malloc(max_atoms * num_nbrs * sizeof(int32_t));
+
+			int m = 0;
+			for (int i=0;i<n;i++)
+				for (int j=0;j<n;j++)
+					for (int k=0;k<n;k++)
+						for (int b=0;b<4;b++,m++)
+						{
+							double x[3] = {2.0 * (i + basis[b][0]), 2.0 * (j + basis[b][1]), 2.0 * (k + basis[b][2])};
+							for (int l=0;l<3;l++)
+								deformed[3 * m + l] = F0[3 * l + 0] * x[0] + F0[3 * l + 1] * x[1] + F0[3 * l + 2] * x[2];
+						}
+			find_nearest_neighbours(m, deformed, NULL, num_nbrs, deformed_nbrs);
+
+			ptm_batch_output_t strain_output;
+			memset(&strain_output, 0, sizeof(ptm_batch_output_t));
+			strain_output.type = strain_types;
+			strain_output.von_mises_strain = von_mises;
+			strain_output.volumetric_strain = volumetric;
+			strain_output.green_lagrange = green_lagrange;
+			strain_output.U = rotation;
+			strain_output.P = stretch;
+
+			ptm_batch_config_t strain_config = config;
+			strain_config.skip_tolerance = 0;
+			strain_config.reference_lattice_constant[PTM_MATCH_FCC] = 2.0;
+
+			ptm_batch_handle_t strain_handle = ptm_initialize_batch(2);
+			ret |= ptm_index_batch(strain_handle, &strain_config, m, deformed, NULL, num_nbrs, num_nbrs, deformed_nbrs, &strain_output, NULL);
+			ptm_uninitialize_batch(strain_handle);
+
+			//rotation-invariant quantities of F0
+			double det = F0[0] * (F0[4] * F0[8] - F0[5] * F0[7]) - F0[1] * (F0[3] * F0[8] - F0[5] * F0[6]) + F0[2] * (F0[3] * F0[7] - F0[4] * F0[6]);
+			double trace_E = 0;
+			for (int l=0;l<9;l++)
+				trace_E += F0[l] * F0[l] / 2;
+			trace_E -= 1.5;
+
+			//F0 is symmetric positive definite, so it is its own left stretch tensor
+			double S[9];
+			for (int l=0;l<9;l++)
+				S[l] = F0[l] - (l % 4 == 0 ? 1 : 0);
+			double t = (S[0] - S[4]) * (S[0] - S[4]) + (S[4] - S[8]) * (S[4] - S[8]) + (S[8] - S[0]) * (S[8] - S[0]);
+			t += 6 * (S[5] * S[5] + S[6] * S[6] + S[1] * S[1]);
+			double expected_von_mises = sqrt(t / 2);
+
+			int num_strained = 0;
+			for (int i=0;i<m && ret == 0;i++)
+			{
+				if (strain_types[i] != PTM_MATCH_FCC)
+					continue;
+
+				double* E = &green_lagrange[9 * i];
+				if (fabs(volumetric[i] - (det - 1)) > 1E-9 || fabs(E[0] + E[4] + E[8] - trace_E) > 1E-9 || fabs(von_mises[i] - expected_von_mises) > 1E-9)
+					ret = -1;
+				if (fabs(E[1] - E[3]) > 1E-12 || fabs(E[2] - E[6]) > 1E-12 || fabs(E[5] - E[7]) > 1E-12)
+					ret = -1;
+				num_strained++;
+
+				//the block-wise polar decompositions reproduce single-atom indexing exactly
+				double points[MAX_NBRS + 1][3] = {{0}};
+				for (int k=0;k<num_nbrs;k++)
+					for (int j=0;j<3;j++)
+						points[k+1][j] = deformed[3 * deformed_nbrs[i * num_nbrs + k] + j] - deformed[3 * i + j];
+
+				int32_t type;
+				double scale, rmsd, q[4], F[9], F_res[3], U[9], P[9];
+				ptm_index(local_handle, num_nbrs + 1, points[0], NULL, PTM_CHECK_ALL, true, &type, NULL, &scale, &rmsd, q, F, F_res, U, P, NULL, NULL, NULL);
+				if (memcmp(U, &rotation[9 * i], sizeof(U)) != 0 || memcmp(P, &stretch[9 * i], sizeof(P)) != 0)
+					ret = -1;
+			}
+
+			free(deformed);
+			free(strain_types);
+			free(von_mises);
+			free(volumetric);
+			free(green_lagrange);
+			free(stretch);
+			free(rotation);
+			free(deformed_nbrs);
+			if (ret != 0 || num_strained == 0)
+				CLEANUP("failed on batch strain outputs", -1);
+		}
+
+		//coarse-grained grid fields match a binning of the per-atom outputs, including when every atom is skipped, and
+		//when the memory bound makes the workers share a single partial grid
+		{
+			const int num_types = PTM_MATCH_SC + 1;
+			ptm_batch_grid_t grid;
+			memset(&grid, 0, sizeof(ptm_batch_grid_t));
+			for (int j=0;j<3;j++)
+			{
+				grid.dims[j] = j == 2 ? 3 : 2;
+				grid.voxel_size[j] = j == 2 ? 3 : 4;
+			}
+			grid.orientation_type = PTM_MATCH_FCC;
+			int num_voxels = grid.dims[0] * grid.dims[1] * grid.dims[2];
+			grid.counts = (int64_t*)malloc(num_types * num_voxels * sizeof(int64_t));
+			grid.mean_rmsd = (double*)malloc(num_voxels * sizeof(double));
+			grid.mean_lattice_constant = (double*)malloc(num_voxels * sizeof(double));
+			grid.orientation = (double*)malloc(4 * num_voxels * sizeof(double));
+			int32_t* grid_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			double* grid_rmsds = (double*)malloc(max_atoms * sizeof(double));
+			double* grid_quats = (double*)malloc(4 * max_atoms * sizeof(double));
+			int* voxels = (int*)malloc(max_atoms * sizeof(int));
+
+			ptm_batch_output_t grid_output;
+			memset(&grid_output, 0, sizeof(ptm_batch_output_t));
+			grid_output.type = grid_types;
+			grid_output.rmsd = grid_rmsds;
+			grid_output.q = grid_quats;
+			grid_output.grid = &grid;
+
+			ptm_batch_config_t grid_config = config;
+			grid_config.summarize = false;
+
+			ptm_batch_stats_t grid_stats;
+			ptm_batch_handle_t grid_handle = ptm_initialize_batch(3);
+			for (int frame=0;frame<4 && ret == 0;frame++)
+			{
+				if (frame == 2)
+				{
+					ptm_reset_batch(grid_handle);
+					grid.max_partial_bytes = 1;
+				}
+
+				ret = ptm_index_batch(grid_handle, &grid_config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &grid_output, &grid_stats);
+				if (ret != PTM_NO_ERROR || grid_stats.num_skipped != (frame % 2 == 0 ? 0 : num_atoms))
+				{
+					ret = -1;
+					break;
+				}
+
+				int64_t num_gridded = 0;
+				for (int i=0;i<num_atoms;i++)
+				{
+					voxels[i] = 0;
+					for (int j=2;j>=0;j--)
+					{
+						int f = (int)floor((positions[3 * i + j] - grid.origin[j]) / grid.voxel_size[j]);
+						voxels[i] = f < 0 || f >= grid.dims[j] || voxels[i] < 0 ? -1 : voxels[i] * grid.dims[j] + f;
+					}
+					num_gridded += voxels[i] >= 0;
+				}
+
+				int64_t total = 0;
+				for (int v=0;v<num_voxels;v++)
+				{
+					int64_t counts[num_types] = {0};
+					double sum = 0;
+					for (int i=0;i<num_atoms;i++)
+					{
+						if (voxels[i] != v)
+							continue;
+						counts[grid_types[i]]++;
+						if (grid_types[i] != PTM_MATCH_NONE)
+							sum += grid_rmsds[i];
+					}
+
+					int64_t num_matched = 0, num_fcc = counts[PTM_MATCH_FCC];
+					for (int j=0;j<num_types;j++)
+					{
+						if (grid.counts[v * num_types + j] != counts[j])
+							ret = -1;
+						total += counts[j];
+						num_matched += j != PTM_MATCH_NONE ? counts[j] : 0;
+					}
+
+					if (num_matched == 0 && (!std::isnan(grid.mean_rmsd[v]) || !std::isnan(grid.mean_lattice_constant[v])))
+						ret = -1;
+					if (num_matched > 0 && (fabs(grid.mean_rmsd[v] - sum / num_matched) > 1E-12 || fabs(grid.mean_lattice_constant[v] - 2.0) > 0.05))
+						ret = -1;
+
+					//only fcc atoms are averaged, and each is close to the voxel's mean orientation
+					double* qv = &grid.orientation[4 * v];
+					double norm = qv[0] * qv[0] + qv[1] * qv[1] + qv[2] * qv[2] + qv[3] * qv[3];
+					if (fabs(norm - (num_fcc > 0 ? 1 : 0)) > 1E-9)
+						ret = -1;
+
+					for (int i=0;i<num_atoms;i++)
+						if (voxels[i] == v && grid_types[i] == PTM_MATCH_FCC && quat_disorientation_cubic(qv, &grid_quats[4 * i]) > 0.02)
+							ret = -1;
+				}
+
+				if (total != num_gridded || num_gridded == 0 || num_gridded == num_atoms)
+					ret = -1;
+			}
+
+			//invalid grids are rejected
+			grid.voxel_size[1] = 0;
+			if (ret == 0 && ptm_index_batch(grid_handle, &grid_config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &grid_output, NULL) != PTM_BATCH_INVALID_ARGUMENT)
+				ret = -1;
+
+			ptm_uninitialize_batch(grid_handle);
+			free(grid.counts);
+			free(grid.mean_rmsd);
+			free(grid.mean_lattice_constant);
+			free(grid.orientation);
+			free(grid_types);
+			free(grid_rmsds);
+			free(grid_quats);
+			free(voxels);
+			if (ret != 0)
+				CLEANUP("failed on batch grid", -1);
+		}
+
+		//unchanged frame is skipped entirely
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+
+		if (stats.num_skipped != num_atoms || stats.skipped_fraction != 1)
+			CLEANUP("failed on batch skip count", -1);
+
+		//skipped atoms are still summarized
+		for (int j=0;j<=PTM_MATCH_SC;j++)
+		{
+			int64_t count = 0;
+			for (int i=0;i<num_atoms;i++)
+				count += types[i] == j;
+			if (stats.structure_counts[j] != count)
+				CLEANUP("failed on batch summary of skipped atoms", -1);
+		}
+
+		//only neighbourhoods containing the moved atom are recomputed
+		auto num_affected_by = [&](int atom) {
+			int num = 1;
+			for (int i=0;i<num_atoms;i++)
+				for (int k=0;k<num_nbrs;k++)
+					if (nbrs[i * num_nbrs + k] == atom)
+						num++;
+			return num;
+		};
+
+		int moved = num_atoms / 2, num_affected = num_affected_by(moved);
+
+		positions[3 * moved] += 0.05;
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+
+		if (stats.num_skipped != num_atoms - num_affected)
+			CLEANUP("failed on batch skip count", -1);
+
+		//a frame indexed without skipping invalidates the stored results, even where the neighbourhoods are back to
+		//where they were when last indexed with skipping
+		{
+			int32_t* skip_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			double* skip_rmsds = (double*)malloc(max_atoms * sizeof(double));
+			memcpy(skip_types, types, num_atoms * sizeof(int32_t));
+			memcpy(skip_rmsds, rmsds, num_atoms * sizeof(double));
+
+			config.skip_tolerance = 0;
+			positions[3 * moved] += 0.6;
+			ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+
+			config.skip_tolerance = 0.01;
+			positions[3 * moved] -= 0.6;
+			ret |= ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+			if (ret == 0 && stats.num_skipped != 0)
+				ret = -1;
+
+			for (int i=0;i<num_atoms && ret == 0;i++)
+				if (types[i] != skip_types[i] || rmsds[i] != skip_rmsds[i])
+					ret = -1;
+
+			free(skip_types);
+			free(skip_rmsds);
+			if (ret != 0)
+				CLEANUP("failed on batch skipping after a frame without skipping", -1);
+		}
+
+		//a changed species is not skipped, and the alloy type follows it
+		{
+			int32_t* numbers = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			int32_t* alloy_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			int32_t* ref_alloy_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+			for (int i=0;i<num_atoms;i++)
+				numbers[i] = 1;
+
+			ptm_batch_output_t alloy_output = output;
+			alloy_output.alloy_type = alloy_types;
+			ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, numbers, num_nbrs, num_nbrs, nbrs, &alloy_output, &stats);
+
+			int swapped = num_atoms / 3;
+			numbers[swapped] = 2;
+			ret |= ptm_index_batch(batch_handle, &config, num_atoms, positions, numbers, num_nbrs, num_nbrs, nbrs, &alloy_output, &stats);
+			if (ret == 0 && stats.num_skipped != num_atoms - num_affected_by(swapped))
+				ret = -1;
+
+			ptm_batch_config_t full_config = config;
+			full_config.skip_tolerance = 0;
+			ptm_batch_handle_t full_handle = ptm_initialize_batch(1);
+			alloy_output.alloy_type = ref_alloy_types;
+			ret |= ptm_index_batch(full_handle, &full_config, num_atoms, positions, numbers, num_nbrs, num_nbrs, nbrs, &alloy_output, NULL);
+			ptm_uninitialize_batch(full_handle);
+
+			for (int i=0;i<num_atoms && ret == 0;i++)
+				if (alloy_types[i] != ref_alloy_types[i])
+					ret = -1;
+
+			free(numbers);
+			free(alloy_types);
+			free(ref_alloy_types);
+			if (ret != 0)
+				CLEANUP("failed on batch skipping after a species change", -1);
+		}
+
+		//warm start reproduces the full search
+		int32_t* ref_types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+		double* ref_rmsds = (double*)malloc(max_atoms * sizeof(double));
+		memcpy(ref_types, types, num_atoms * sizeof(int32_t));
+		memcpy(ref_rmsds, rmsds, num_atoms * sizeof(double));
+
+		config.skip_tolerance = 0;
+		config.warm_start_rmsd = 0.1;
+		positions[3 * moved] -= 0.05;
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		positions[3 * moved] += 0.05;
+		ret |= ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+
+		for (int i=0;i<num_atoms && ret == 0;i++)
+			if (types[i] != ref_types[i] || (types[i] == PTM_MATCH_FCC && fabs(rmsds[i] - ref_rmsds[i]) > tolerance))
+				ret = -1;
+
+		//the previous correspondence follows the neighbours when their order is permuted.  The atoms are displaced too far
+		//for the full search to find fcc everywhere, so atoms which stay fcc below a generous rmsd were warm started.
+		int32_t* prev_nbrs = (int32_t*)malloc(max_atoms * num_nbrs * sizeof(int32_t));
+		int8_t* prev_mappings = (int8_t*)malloc(PTM_MAX_POINTS * max_atoms * sizeof(int8_t));
+		double* prev_positions = (double*)malloc(3 * max_atoms * sizeof(double));
+		memcpy(prev_nbrs, nbrs, num_atoms * num_nbrs * sizeof(int32_t));
+		memcpy(prev_mappings, mappings, num_atoms * PTM_MAX_POINTS * sizeof(int8_t));
+		memcpy(prev_positions, positions, 3 * num_atoms * sizeof(double));
+
+		srand(26);
+		for (int i=0;i<num_atoms;i++)
+			for (int k=num_nbrs-1;k>0;k--)
+				std::swap(nbrs[i * num_nbrs + k], nbrs[i * num_nbrs + rand() % (k + 1)]);
+		for (int i=0;i<3 * num_atoms;i++)
+			positions[i] += 0.6 * (rand() / (double)RAND_MAX - 0.5);
+
+		config.warm_start_rmsd = 10;
+		ret |= ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		config.warm_start_rmsd = 0.1;
+		for (int i=0;i<num_atoms && ret == 0;i++)
+		{
+			if (ref_types[i] != PTM_MATCH_FCC)
+				continue;
+
+			if (types[i] != PTM_MATCH_FCC)
+				ret = -1;
+
+			//the same atoms are mapped to each template point
+			for (int k=1;k<=ptm_num_nbrs[PTM_MATCH_FCC] && ret == 0;k++)
+				if (nbrs[i * num_nbrs + mappings[i * PTM_MAX_POINTS + k] - 1] != prev_nbrs[i * num_nbrs + prev_mappings[i * PTM_MAX_POINTS + k] - 1])
+					ret = -1;
+		}
+
+		memcpy(positions, prev_positions, 3 * num_atoms * sizeof(double));
+		free(prev_positions);
+
+		//a changed neighbour set is not warm started: an atom moved into an fcc neighbourhood, in place of an unmapped
+		//neighbour, must be seen even though the mapped neighbours have not moved
+		int centre = 4 * ((n / 2 * n + n / 2) * n + n / 2);	//first atom of the middle unit cell
+		bool mapped[MAX_NBRS] = {false};
+		if (types[centre] != PTM_MATCH_FCC)
+			ret = -1;
+		for (int k=1;k<=ptm_num_nbrs[PTM_MATCH_FCC] && ret == 0;k++)
+			mapped[mappings[centre * PTM_MAX_POINTS + k] - 1] = true;
+
+		int unmapped = 0;
+		while (mapped[unmapped])
+			unmapped++;
+
+		//atom 0 is at a corner of the crystal, so it is not a neighbour of the central atom
+		int interstitial = 0;
+		nbrs[centre * num_nbrs + unmapped] = interstitial;
+		for (int j=0;j<3;j++)
+			positions[3 * interstitial + j] = positions[3 * centre + j] + 0.3 + 0.1 * j;
+
+		ret |= ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		memcpy(ref_types, types, num_atoms * sizeof(int32_t));
+		memcpy(ref_rmsds, rmsds, num_atoms * sizeof(double));
+
+		ptm_batch_config_t full_config = config;
+		full_config.warm_start_rmsd = 0;
+		ptm_batch_handle_t full_handle = ptm_initialize_batch(4);
+		ret |= ptm_index_batch(full_handle, &full_config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, &stats);
+		ptm_uninitialize_batch(full_handle);
+
+		for (int i=0;i<num_atoms && ret == 0;i++)
+			if (types[i] != ref_types[i] || (types[i] == PTM_MATCH_FCC && fabs(rmsds[i] - ref_rmsds[i]) > tolerance))
+				ret = -1;
+
+		if (ret == 0 && types[centre] == PTM_MATCH_FCC && rmsds[centre] < 0.1)
+			ret = -1;
+
+		ptm_uninitialize_batch(batch_handle);
+		free(prev_nbrs);
+		free(prev_mappings);
+		free(ref_types);
+		free(ref_rmsds);
+		free(positions);
+		free(nbrs);
+		free(types);
+		free(rmsds);
+		free(quats);
+		free(mappings);
+
+		if (ret != 0)
+			CLEANUP("failed on batch warm start", -1);
+
+		num_tests++;
+	}
+
+	//Verlet-skin neighbour lists in a periodic cell
+	{
+		const int n = 5, num_nbrs = MAX_NBRS;
+		int max_atoms = 4 * n * n * n;
+		double box[3] = {n * 2.0, n * 2.0, n * 2.0};
+		double* positions = (double*)malloc(3 * max_atoms * sizeof(double));
+		int32_t* nbrs = (int32_t*)malloc(max_atoms * num_nbrs * sizeof(int32_t));
+		int32_t* ref_nbrs = (int32_t*)malloc(max_atoms * num_nbrs * sizeof(int32_t));
+		int32_t* types = (int32_t*)malloc(max_atoms * sizeof(int32_t));
+
+		int num_atoms = build_fcc_crystal(n, 2.0, positions);
+		ptm_nbrlist_handle_t nbrlist = ptm_initialize_nbrlist(2.8, 0.3);
+
+		//the first call builds the list, a small displacement reuses it and a large one triggers a rebuild
+		bool rebuilt[3];
+		double displacement[3] = {0, 0.1, 0.5};
+		for (int it=0;it<3 && ret == 0;it++)
+		{
+			positions[0] += displacement[it];
+			ret = ptm_find_neighbours(nbrlist, num_atoms, positions, box, num_nbrs, nbrs, &rebuilt[it]);
+			if (ret != PTM_NO_ERROR)
+				break;
+
+			find_nearest_neighbours(num_atoms, positions, box, num_nbrs, ref_nbrs);
+			for (int i=0;i<num_atoms * num_nbrs && ret == 0;i++)
+				if (nbrs[i] != ref_nbrs[i])
+					ret = -1;
+		}
+
+		if (ret == 0 && (!rebuilt[0] || rebuilt[1] || !rebuilt[2]))
+			ret = -1;
+
+		//too small a cutoff is reported rather than silently returning distant atoms
+		ptm_nbrlist_handle_t short_nbrlist = ptm_initialize_nbrlist(1.0, 0.1);
+		if (ret == 0 && ptm_find_neighbours(short_nbrlist, num_atoms, positions, box, num_nbrs, nbrs, NULL) != PTM_NBRLIST_CUTOFF_TOO_SMALL)
+			ret = -1;
+		ptm_uninitialize_nbrlist(short_nbrlist);
+
+		//a periodic cell narrower than twice the cutoff and skin has more than one image of some neighbours
+		double narrow_box[3] = {6.0, box[1], box[2]};
+		if (ret == 0 && ptm_find_neighbours(nbrlist, num_atoms, positions, narrow_box, num_nbrs, nbrs, NULL) != PTM_NBRLIST_INVALID_ARGUMENT)
+			ret = -1;
+
+		//nothing is written when the cutoff is too small for any atom: with open boundaries the interior atom, put first,
+		//has enough neighbours but the surface atoms which follow do not
+		if (ret == 0)
+		{
+			const int centre = 4 * ((n / 2 * n + n / 2) * n + n / 2);
+			double* swapped = (double*)malloc(3 * max_atoms * sizeof(double));
+			memcpy(swapped, positions, 3 * num_atoms * sizeof(double));
+			for (int j=0;j<3;j++)
+				std::swap(swapped[j], swapped[3 * centre + j]);
+
+			for (int i=0;i<num_atoms * num_nbrs;i++)
+				nbrs[i] = -1;
+
+			ptm_nbrlist_handle_t open_nbrlist = ptm_initialize_nbrlist(2.8, 0.3);
+			if (ptm_find_neighbours(open_nbrlist, num_atoms, swapped, NULL, num_nbrs, nbrs, NULL) != PTM_NBRLIST_CUTOFF_TOO_SMALL)
+				ret = -1;
+			ptm_uninitialize_nbrlist(open_nbrlist);
+
+			for (int i=0;i<num_atoms * num_nbrs;i++)
+				if (nbrs[i] != -1)
+					ret = -1;
+			free(swapped);
+		}
+
+		//every atom of the periodic crystal is fcc when the batch driver applies the minimum image
+		if (ret == 0)
+		{
+			positions[0] -= 0.6;
+			ret = ptm_find_neighbours(nbrlist, num_atoms, positions, box, num_nbrs, nbrs, NULL);
+
+			ptm_batch_output_t output;
+			memset(&output, 0, sizeof(ptm_batch_output_t));
+			output.type = types;
+
+			ptm_batch_config_t config;
+			memset(&config, 0, sizeof(ptm_batch_config_t));
+			config.flags = PTM_CHECK_FCC;
+			config.box = box;
+
+			ptm_batch_handle_t batch_handle = ptm_initialize_batch(2);
+			ret |= ptm_index_batch(batch_handle, &config, num_atoms, positions, NULL, num_nbrs, num_nbrs, nbrs, &output, NULL);
+			ptm_uninitialize_batch(batch_handle);
+
+			for (int i=0;i<num_atoms && ret == 0;i++)
+				if (types[i] != PTM_MATCH_FCC)
+					ret = -1;
+		}
+
+		//two distant clusters with open boundaries need only a bounded number of cells
+		if (ret == 0)
+		{
+			int num_open = build_fcc_crystal(3, 2.0, positions);
+			for (int i=0;i<num_open;i++)
+				for (int j=0;j<3;j++)
+					positions[3 * (num_open + i) + j] = positions[3 * i + j] + 1E4;
+			num_open *= 2;
+
+			ptm_nbrlist_handle_t open_nbrlist = ptm_initialize_nbrlist(4.0, 0.3);
+			ret = ptm_find_neighbours(open_nbrlist, num_open, positions, NULL, num_nbrs, nbrs, NULL);
+			ptm_uninitialize_nbrlist(open_nbrlist);
+
+			find_nearest_neighbours(num_open, positions, NULL, num_nbrs, ref_nbrs);
+			for (int i=0;i<num_open * num_nbrs && ret == 0;i++)
+				if (nbrs[i] != ref_nbrs[i])
+					ret = -1;
+		}
+
+		ptm_uninitialize_nbrlist(nbrlist);
+		free(positions);
+		free(nbrs);
+		free(ref_nbrs);
+		free(types);
+
+		if (ret != 0)
+			CLEANUP("failed on neighbour lists", -1);
+
+		num_tests++;
+	}
+
+	//the convex hull finds the same facets as the previous implementation, for random, degenerate and incrementally extended point sets
+	{
+		const double (*templates[5])[3] = {ptm_template_sc, ptm_template_fcc, ptm_template_hcp, ptm_template_ico, ptm_template_bcc};
+		const int sizes[3] = {7, 13, 15};
+		srand(15);
+
+		int num_checked = 0;
+		for (int it=0;it<3000 && ret == 0;it++)
+		{
+			//perfect templates have coplanar facets; small noise is near the visibility tolerance and larger noise is generic
+			double points[15][3];
+			int kind = it % 4;
+			int s = (it / 4) % 5, template_size[5] = {7, 13, 13, 13, 15};
+			double noise = kind == 0 ? 0 : kind == 1 ? 1E-8 : kind == 2 ? 0.05 : 0.3;
+			for (int i=0;i<15;i++)
+				for (int j=0;j<3;j++)
+				{
+					double x = i < template_size[s] ? templates[s][i][j] : rand() / (double)RAND_MAX - 0.5;
+					points[i][j] = i == 0 ? 0 : x + noise * (rand() / (double)RAND_MAX - 0.5);
+				}
+
+			//hulls are extended from 7 to 13 to 15 points as in ptm_index, and rebuilt after a failure
+			convexhull_t ch;
+			referencehull_t ref;
+			memset(&ch, 0, sizeof(convexhull_t));
+			memset(&ref, 0, sizeof(referencehull_t));
+			for (int k=0;k<3;k++)
+			{
+				int n = sizes[k], num_facets = 2 * (n - 1) - 4;
+				int8_t simplex[MAXF][3];
+				bool reinitialized = !ch.ok;
+				int r = get_convex_hull(n, (const double (*)[3])points, num_facets, &ch, simplex);
+				int r_ref = reinitialized && r <= -1 && r >= -3 ? r : reference_convex_hull(n, (const double (*)[3])points, num_facets, ch.initial_vertices, &ref);
+				if (r != r_ref)
+					ret = -1;
+
+				if (r == 0 && (ch.num_facets != ref.num_facets || memcmp(ch.facets, ref.facets, 3 * ch.num_facets * sizeof(int8_t)) != 0))
+					ret = -1;
+
+				num_checked += r == 0;
+				ch.ok = r == 0;
+				ref.ok = r_ref == 0;
+			}
+		}
+
+		if (ret != 0 || num_checked == 0)
+			CLEANUP("failed on convex hull facets", -1);
+
+		num_tests++;
+	}
+
+	//concurrent global initialization
+	{
+		const int num_threads = 8;
+		int results[num_threads];
+		std::vector<std::thread> threads;
+		for (int i=0;i<num_threads;i++)
+			threads.push_back(std::thread([&results, i]() { results[i] = ptm_initialize_global(); }));
+
+		for (int i=0;i<num_threads;i++)
+			threads[i].join();
+
+		for (int i=0;i<num_threads;i++)
+			if (results[i] != PTM_NO_ERROR)
+				ret = -1;
+
+		if (ret != 0 || !ptm_is_initialized())
+			CLEANUP("failed on concurrent initialization", -1);
+
+		num_tests++;
+	}
+
+	//generated graph tables are consistent with the canonical form code
+	{
+		const graphtable_t* tables[5] = {&graph_table_sc, &graph_table_fcc, &graph_table_hcp, &graph_table_ico, &graph_table_bcc};
+		const double (*points[5])[3] = {ptm_template_sc, ptm_template_fcc, ptm_template_hcp, ptm_template_ico, ptm_template_bcc};
+		int num_nodes[5] = {6, 12, 12, 12, 14};
+		for (int t=0;t<5 && ret == 0;t++)
+		{
+			const graphtable_t* table = tables[t];
+			int num_facets = 2 * num_nodes[t] - 4;
+			for (int i=0;i<table->num_graphs && ret == 0;i++)
+			{
+				graph_t g = table->graphs[i];
+				int8_t degree[PTM_MAX_NBRS], canonical_labelling[PTM_MAX_POINTS];
+				uint64_t hash = 0;
+				graph_degree(num_facets, g.facets, num_nodes[t], degree);
+				canonical_form(num_facets, g.facets, num_nodes[t], degree, canonical_labelling, &hash);
+				if (hash != g.hash || memcmp(canonical_labelling, g.canonical_labelling, num_nodes[t] + 1) != 0)
+					ret = -1;
+
+				if (i > 0 && table->hash_index[i].hash < table->hash_index[i-1].hash)
+					ret = -1;
+
+				if (table->graphs[table->hash_index[i].graph].hash != table->hash_index[i].hash)
+					ret = -1;
+
+				uint64_t key = degree_sequence_key(num_nodes[t], degree);
+				bool found = false;
+				for (int j=0;j<table->num_degree_sequences;j++)
+					found |= table->degree_sequences[j] == key;
+				if (!found)
+					ret = -1;
+
+				//permuted templates are the template points in canonical order, for every automorphism
+				int first = table->first_template[i];
+				if (i + 1 < table->num_graphs && table->first_template[i + 1] != first + g.num_automorphisms)
+					ret = -1;
+
+				for (int j=0;j<g.num_automorphisms;j++)
+				{
+					const permutedtemplate_t* p = &table->templates[first + j];
+					for (int k=0;k<=num_nodes[t];k++)
+					{
+						int index = automorphisms[g.automorphism_index + j][k];
+						if (p->template_index[g.canonical_labelling[k]] != index
+							|| memcmp(p->points[g.canonical_labelling[k]], points[t][index], 3 * sizeof(double)) != 0)
+							ret = -1;
+					}
+				}
+			}
+		}
+
+		if (ret != 0)
+			CLEANUP("graph tables are out of date (run make graph_tables)", -1);
+
+		num_tests++;
+	}
+
+	//canonical forms are invariant under relabelling of the nodes, reordering of the facets and rotation of each facet,
+	//which also checks that the automorphism pruning never skips a start edge giving a better code
+	{
+		const graphtable_t* tables[5] = {&graph_table_sc, &graph_table_fcc, &graph_table_hcp, &graph_table_ico, &graph_table_bcc};
+		int num_nodes[5] = {6, 12, 12, 12, 14};
+		srand(32);
+		for (int t=0;t<5 && ret == 0;t++)
+		{
+			const graphtable_t* table = tables[t];
+			int n = num_nodes[t], num_facets = 2 * n - 4;
+			for (int i=0;i<table->num_graphs && ret == 0;i++)
+			{
+				const graph_t* g = &table->graphs[i];
+
+				//next[a][b] = c for each facet (a, b, c) in canonical labels
+				int8_t expected[PTM_MAX_NBRS][PTM_MAX_NBRS];
+				memset(expected, -1, sizeof(expected));
+				for (int j=0;j<num_facets;j++)
+					for (int k=0;k<3;k++)
+					{
+						int a = g->canonical_labelling[g->facets[j][k] + 1] - 1;
+						int b = g->canonical_labelling[g->facets[j][(k + 1) % 3] + 1] - 1;
+						int c = g->canonical_labelling[g->facets[j][(k + 2) % 3] + 1] - 1;
+						expected[a][b] = c;
+					}
+
+				int num_relabellings = t == 4 ? 10 : 100;
+				for (int it=0;it<num_relabellings;it++)
+				{
+					int8_t relabel[PTM_MAX_NBRS], order[2 * PTM_MAX_NBRS];
+					for (int j=0;j<n;j++)
+						relabel[j] = j;
+					for (int j=0;j<num_facets;j++)
+						order[j] = j;
+
+					for (int j=n-1;j>0;j--)
+						std::swap(relabel[j], relabel[rand() % (j + 1)]);
+					for (int j=num_facets-1;j>0;j--)
+						std::swap(order[j], order[rand() % (j + 1)]);
+
+					int8_t facets[2 * PTM_MAX_NBRS][3];
+					for (int j=0;j<num_facets;j++)
+					{
+						int r = rand() % 3;
+						for (int k=0;k<3;k++)
+							facets[j][k] = relabel[g->facets[order[j]][(k + r) % 3]];
+					}
+
+					int8_t degree[PTM_MAX_NBRS], canonical_labelling[PTM_MAX_POINTS];
+					uint64_t hash = 0;
+					graph_degree(num_facets, facets, n, degree);
+					if (canonical_form(num_facets, facets, n, degree, canonical_labelling, &hash) != 0 || hash != g->hash)
+						ret = -1;
+
+					int8_t next[PTM_MAX_NBRS][PTM_MAX_NBRS];
+					memset(next, -1, sizeof(next));
+					for (int j=0;j<num_facets;j++)
+						for (int k=0;k<3;k++)
+						{
+							int a = canonical_labelling[facets[j][k] + 1] - 1;
+							int b = canonical_labelling[facets[j][(k + 1) % 3] + 1] - 1;
+							int c = canonical_labelling[facets[j][(k + 2) % 3] + 1] - 1;
+							next[a][b] = c;
+						}
+
+					if (memcmp(next, expected, sizeof(next)) != 0)
+						ret = -1;
+				}
+			}
+		}
+
+		if (ret != 0)
+			CLEANUP("failed on relabelled canonical forms", -1);
+
+		num_tests++;
+	}
+
+	//closed-form cubic fundamental zone matches a search over all generators
+	{
+		extern double generator_cubic[24][4];
+		const double v[] = {0, 0.5, -0.5, 1 / sqrt(2), -1 / sqrt(2), 1, 0.3, -0.3, 1E-20, 1 / sqrt(3), -1 / sqrt(3)};
+		const int num_values = sizeof(v) / sizeof(double);
+		const int num_random = 20000;
+
+		std::vector<double> quats;
+		srand(7);
+		for (int i=0;i<num_random;i++)
+			for (int k=0;k<4;k++)
+				quats.push_back(rand() / (double)RAND_MAX - 0.5);
+
+		for (int i=0;i<num_values;i++)
+			for (int j=0;j<num_values;j++)
+				for (int k=0;k<num_values;k++)
+					for (int l=0;l<num_values;l++)
+					{
+						double q[4] = {v[i], v[j], v[k], v[l]};
+						quats.insert(quats.end(), q, q + 4);
+					}
+
+		int num = quats.size() / 4;
+		for (int i=0;i<num;i++)
+		{
+			double* q = &quats[4 * i];
+			double norm = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+			if (norm == 0)
+				q[0] = norm = 1;
+
+			for (int k=0;k<4;k++)
+				q[k] /= norm;
+		}
+
+		std::vector<double> rotated = quats;
+		std::vector<int> bi(num);
+		rotate_quaternions_into_cubic_fundamental_zone(num, &rotated[0], &bi[0]);
+
+		for (int i=0;i<num && ret == 0;i++)
+		{
+			double* q = &quats[4 * i];
+			int best = -1;
+			double max = 0;
+			for (int k=0;k<24;k++)
+			{
+				double* g = generator_cubic[k];
+				double t = fabs(q[0] * g[0] - q[1] * g[1] - q[2] * g[2] - q[3] * g[3]);
+				if (t > max)
+				{
+					max = t;
+					best = k;
+				}
+			}
+
+			double single[4];
+			memcpy(single, q, 4 * sizeof(double));
+			int b = rotate_quaternion_into_cubic_fundamental_zone(single);
+			if (b != best || bi[i] != best || memcmp(single, &rotated[4 * i], 4 * sizeof(double)) != 0)
+				ret = -1;
+
+			if (fabs(rotated[4 * i] - max) > 1E-12)
+				ret = -1;
+		}
+
+		if (ret != 0)
+			CLEANUP("failed on cubic fundamental zone", -1);
+
+		num_tests++;
+	}
+
+	//batch disorientations agree with the scalar functions
+	{
+		const int num_pairs = 5000;
+		std::vector<double> q0(4 * num_pairs), q1(4 * num_pairs), angles(num_pairs);
+		srand(11);
+		for (int i=0;i<4 * num_pairs;i++)
+		{
+			q0[i] = rand() / (double)RAND_MAX - 0.5;
+			q1[i] = rand() / (double)RAND_MAX - 0.5;
+		}
+
+		for (int i=0;i<num_pairs;i++)
+		{
+			normalize_quaternion(&q0[4 * i]);
+			normalize_quaternion(&q1[4 * i]);
+		}
+
+		int32_t types[3] = {PTM_MATCH_FCC, PTM_MATCH_HCP, PTM_MATCH_ICO};
+		double (*scalar[3])(double*, double*) = {quat_disorientation_cubic, quat_disorientation_hcp, quat_disorientation_icosahedral};
+		for (int t=0;t<3;t++)
+		{
+			if (ptm_disorientations(types[t], num_pairs, &q0[0], &q1[0], 4, &angles[0]) != PTM_NO_ERROR)
+				ret = -1;
+
+			for (int i=0;i<num_pairs;i++)
+				if (fabs(angles[i] - scalar[t](&q0[4 * i], &q1[4 * i])) > 1E-6)
+					ret = -1;
+		}
+
+		//neighbour pairs: atom i is bonded to i + 1 and i + 2, and every fifth atom is unmatched
+		const int num_atoms = 1000, num_nbrs = 2;
+		std::vector<int32_t> atom_types(num_atoms), nbrs(num_atoms * num_nbrs);
+		std::vector<double> nbr_angles(num_atoms * num_nbrs);
+		for (int i=0;i<num_atoms;i++)
+		{
+			atom_types[i] = i % 5 == 0 ? PTM_MATCH_NONE : (i < num_atoms / 2 ? PTM_MATCH_BCC : PTM_MATCH_HCP);
+			nbrs[i * num_nbrs + 0] = (i + 1) % num_atoms;
+			nbrs[i * num_nbrs + 1] = (i + 2) % num_atoms;
+		}
+
+		if (ptm_neighbour_disorientations(num_atoms, &atom_types[0], &q0[0], num_nbrs, num_nbrs, &nbrs[0], 3, &nbr_angles[0]) != PTM_NO_ERROR)
+			ret = -1;
+
+		for (int i=0;i<num_atoms;i++)
+		{
+			for (int k=0;k<num_nbrs;k++)
+			{
+				int j = nbrs[i * num_nbrs + k];
+				double angle = nbr_angles[i * num_nbrs + k];
+				if (atom_types[i] == PTM_MATCH_NONE || atom_types[i] != atom_types[j])
+				{
+					if (!std::isnan(angle))
+						ret = -1;
+				}
+				else
+				{
+					double expected = atom_types[i] == PTM_MATCH_HCP ? quat_disorientation_hcp(&q0[4 * i], &q0[4 * j])
+											: quat_disorientation_cubic(&q0[4 * i], &q0[4 * j]);
+					if (fabs(angle - expected) > 1E-6)
+						ret = -1;
+				}
+			}
+		}
+
+		if (ret != 0)
+			CLEANUP("failed on batch disorientations", -1);
+
+		num_tests++;
+	}
+
+	//grain segmentation: a ring of simple cubic atoms in two grains 20 degrees apart, with symmetric variants and noise within each grain
+	{
+		const int num_atoms = 1000, nbr_stride = 6;
+		std::vector<int32_t> atom_types(num_atoms), nbrs(num_atoms * nbr_stride), grain_ids(num_atoms);
+		std::vector<int8_t> mapping(num_atoms * PTM_MAX_POINTS, -1);
+		std::vector<double> q(4 * num_atoms);
+
+		double qa[4] = {1, 0.1, 0.2, 0.3};
+		double qb[4], r[4] = {cos(10 * M_PI / 180), sin(10 * M_PI / 180), 0, 0};
+		double variant[4] = {sqrt(0.5), 0, 0, sqrt(0.5)};
+		normalize_quaternion(qa);
+		quat_rot(r, qa, qb);
+
+		srand(12);
+		for (int i=0;i<num_atoms;i++)
+		{
+			atom_types[i] = i % 7 == 3 ? PTM_MATCH_NONE : PTM_MATCH_SC;
+			for (int k=0;k<nbr_stride;k++)
+			{
+				int offset = (k / 2 + 1) * (k % 2 ? -1 : 1);
+				nbrs[i * nbr_stride + k] = (i + offset + num_atoms) % num_atoms;
+				mapping[i * PTM_MAX_POINTS + k + 1] = k + 1;
+			}
+
+			double noise[4] = {1, 0, 0, 0};
+			for (int l=1;l<4;l++)
+				noise[l] = 0.002 * (rand() / (double)RAND_MAX - 0.5);
+			normalize_quaternion(noise);
+
+			double temp[4];
+			quat_rot(i < num_atoms / 2 ? qa : qb, noise, temp);
+			if (i % 3 == 0)
+				quat_rot(temp, variant, &q[4 * i]);
+			else
+				memcpy(&q[4 * i], temp, 4 * sizeof(double));
+		}
+
+		ptm_grains_t grains;
+		if (ptm_segment_grains(num_atoms, &atom_types[0], &q[0], &mapping[0], nbr_stride, &nbrs[0],
+					5 * M_PI / 180, 3, &grain_ids[0], &grains) != PTM_NO_ERROR)
+			CLEANUP("failed on grain segmentation", -1);
+
+		if (grains.num_grains != 2)
+			ret = -1;
+
+		int64_t expected_sizes[2] = {0, 0};
+		for (int i=0;i<num_atoms;i++)
+		{
+			int expected = atom_types[i] == PTM_MATCH_NONE ? -1 : (i < num_atoms / 2 ? 0 : 1);
+			if (grain_ids[i] != expected)
+				ret = -1;
+			if (expected >= 0)
+				expected_sizes[expected]++;
+		}
+
+		for (int g=0;g<grains.num_grains && ret == 0;g++)
+		{
+			if (grains.types[g] != PTM_MATCH_SC || grains.sizes[g] != expected_sizes[g])
+				ret = -1;
+			if (quat_disorientation_cubic(&grains.orientations[4 * g], g == 0 ? qa : qb) > 0.01)
+				ret = -1;
+			if (grains.spreads[g] > 0.01)
+				ret = -1;
+		}
+
+		ptm_release_grains(&grains);
+		if (ret != 0)
+			CLEANUP("failed on grain segmentation", -1);
+
+		num_tests++;
+	}
+
+	//grain statistics: hcp atoms rotated by +/-theta about the c axis, in symmetric variants, have a spread of theta,
+	//and accumulating in chunks gives the same result as a single pass
+	{
+		const int num_atoms = 3000;
+		const double theta = 3 * M_PI / 180;
+		extern double generator_hcp[6][4];
+		std::vector<int32_t> atom_types(num_atoms, PTM_MATCH_HCP), grain_ids(num_atoms);
+		std::vector<double> q(4 * num_atoms);
+
+		double mean[4] = {0.9, -0.2, 0.3, 0.1};
+		normalize_quaternion(mean);
+		for (int i=0;i<num_atoms;i++)
+		{
+			grain_ids[i] = i % 3 == 2 ? -1 : i % 3;
+			double angle = i % 2 ? theta : -theta;
+			double r[4] = {cos(angle / 2), 0, 0, sin(angle / 2)};
+			double temp[4];
+			quat_rot(mean, r, temp);
+			quat_rot(temp, generator_hcp[i % 6], &q[4 * i]);
+		}
+
+		int64_t counts[2][2];
+		int32_t grain_types[2][2];
+		double orientations[2][8], spreads[2][2];
+		for (int k=0;k<2;k++)
+		{
+			ptm_grain_accumulator_handle_t accumulator = ptm_initialize_grain_accumulator(2);
+			int chunk = k == 0 ? num_atoms : 1000;
+			for (int first=0;first<num_atoms;first+=chunk)
+				if (ptm_accumulate_grains(accumulator, chunk, &grain_ids[first], &atom_types[first], &q[4 * first], 3) != PTM_NO_ERROR)
+					ret = -1;
+
+			if (ptm_grain_statistics(accumulator, counts[k], grain_types[k], orientations[k], spreads[k]) != PTM_NO_ERROR)
+				ret = -1;
+			ptm_uninitialize_grain_accumulator(accumulator);
+		}
+
+		for (int g=0;g<2;g++)
+		{
+			if (counts[0][g] != num_atoms / 3 || counts[1][g] != counts[0][g] || grain_types[0][g] != PTM_MATCH_HCP)
+				ret = -1;
+			if (fabs(spreads[0][g] - theta) > 1E-9 || fabs(spreads[1][g] - theta) > 1E-9)
+				ret = -1;
+			if (quat_disorientation_hcp(&orientations[0][4 * g], mean) > 1E-6 || quat_disorientation_hcp(&orientations[1][4 * g], mean) > 1E-6)
+				ret = -1;
+		}
+
+		if (ret != 0)
+			CLEANUP("failed on grain statistics", -1);
+
+		num_tests++;
+	}
+
+	//planar defects: a periodic stack of close-packed layers containing an intrinsic fault, an extrinsic fault and two twin boundaries
+	{
+		//each layer is shifted forwards (+) or backwards (-) from the one below, so the stacking is ABCABCBCABCABACABCABCBACBAC
+		const char* steps = "++++++-++++++--++++++------";
+		const char* expected = ".....II.....E.E.....T.....T";
+		const int num_layers = strlen(steps), nx = 4, ny = 2, num_nbrs = MAX_NBRS;
+		const double a = 1, h = a * sqrt(2. / 3);
+		double box[3] = {nx * a, ny * a * sqrt(3), num_layers * h};
+
+		int num_atoms = 4 * nx * ny * num_layers / 2;
+		std::vector<double> positions(3 * num_atoms), q(4 * num_atoms);
+		std::vector<int32_t> layer(num_atoms), nbrs(num_atoms * num_nbrs), atom_types(num_atoms), labels(num_atoms);
+		std::vector<int8_t> mapping(num_atoms * PTM_MAX_POINTS);
+
+		int m = 0, shift = 0;
+		for (int l=0;l<num_layers;l++)
+		{
+			if (l > 0)
+				shift = (shift + (steps[l] == '+' ? 1 : 2)) % 3;
+
+			for (int i=0;i<nx;i++)
+				for (int j=0;j<ny;j++)
+					for (int b=0;b<2;b++,m++)
+					{
+						layer[m] = l;
+						positions[3 * m + 0] = a * (i + 0.5 * b + 0.5 * shift) + 0.005 * sin(m);
+						positions[3 * m + 1] = a * sqrt(3) * (j + 0.5 * b + shift / 6.) + 0.005 * cos(m);
+						positions[3 * m + 2] = h * l + 0.005 * sin(3 * m);
+					}
+		}
+		find_nearest_neighbours(num_atoms, &positions[0], box, num_nbrs, &nbrs[0]);
+
+		ptm_batch_output_t output;
+		memset(&output, 0, sizeof(ptm_batch_output_t));
+		output.type = &atom_types[0];
+		output.q = &q[0];
+		output.mapping = &mapping[0];
+
+		ptm_batch_config_t config;
+		memset(&config, 0, sizeof(ptm_batch_config_t));
+		config.flags = PTM_CHECK_FCC | PTM_CHECK_HCP;
+		config.topological_ordering = true;
+		config.box = box;
+
+		ptm_batch_handle_t batch_handle = ptm_initialize_batch(2);
+		ret = ptm_index_batch(batch_handle, &config, num_atoms, &positions[0], NULL, num_nbrs, num_nbrs, &nbrs[0], &output, NULL);
+		ptm_uninitialize_batch(batch_handle);
+		if (ret != PTM_NO_ERROR)
+			CLEANUP("batch indexing failed", ret);
+
+		if (ptm_classify_planar_defects(num_atoms, &atom_types[0], &q[0], &mapping[0], num_nbrs, &nbrs[0], 3, &labels[0]) != PTM_NO_ERROR)
+			CLEANUP("failed on planar defects", -1);
+
+		for (int i=0;i<num_atoms;i++)
+		{
+			char c = expected[layer[i]];
+			int32_t label = c == 'I' ? PTM_PLANAR_ISF : c == 'E' ? PTM_PLANAR_ESF : c == 'T' ? PTM_PLANAR_TWIN : PTM_PLANAR_NONE;
+			if (atom_types[i] != (c == '.' ? PTM_MATCH_FCC : PTM_MATCH_HCP) || labels[i] != label)
+				ret = -1;
+		}
+
+		//mapping entries outside the neighbour list are ignored, leaving the hcp atoms without layers
+		std::vector<int8_t> invalid_mapping(mapping);
+		for (int i=0;i<num_atoms;i++)
+			for (int k=1;k<PTM_MAX_POINTS;k++)
+				invalid_mapping[i * PTM_MAX_POINTS + k] = k % 2 == 0 ? num_nbrs + 1 : -1;
+		if (ptm_classify_planar_defects(num_atoms, &atom_types[0], &q[0], &invalid_mapping[0], num_nbrs, &nbrs[0], 3, &labels[0]) != PTM_NO_ERROR)
+			ret = -1;
+		for (int i=0;i<num_atoms;i++)
+			if (labels[i] != (atom_types[i] == PTM_MATCH_HCP ? PTM_PLANAR_OTHER : PTM_PLANAR_NONE))
+				ret = -1;
+
+		//hcp layers with hcp on both sides are not a recognised fault
+		for (int i=0;i<num_atoms;i++)
+			atom_types[i] = PTM_MATCH_HCP;
+		if (ptm_classify_planar_defects(num_atoms, &atom_types[0], &q[0], &mapping[0], num_nbrs, &nbrs[0], 3, &labels[0]) != PTM_NO_ERROR)
+			ret = -1;
+		for (int i=0;i<num_atoms;i++)
+			if (expected[layer[i]] != '.' && labels[i] != PTM_PLANAR_OTHER)
+				ret = -1;
+
+		if (ret != 0)
+			CLEANUP("failed on planar defects", -1);
+
+		num_tests++;
+	}
+
+	//grouped polar decompositions are identical to single ones, including degenerate matrices and partial groups
+	{
+		const int num = 1003;
+		std::vector<double> A(9 * num), U(9 * num), P(9 * num);
+		srand(14);
+		for (int i=0;i<9 * num;i++)
+			A[i] = (i % 9) % 4 == 0 ? 1 + 0.2 * (rand() / (double)RAND_MAX - 0.5) : 0.2 * (rand() / (double)RAND_MAX - 0.5);
+
+		for (int i=0;i<num;i+=5)
+			for (int j=0;j<9;j++)
+				A[9 * i + j] = -A[9 * i + j];
+
+		for (int i=0;i<num;i+=97)
+			memset(&A[9 * i], 0, 9 * sizeof(double));
+
+		polar_decompositions_3x3(num, &A[0], false, &U[0], &P[0]);
+		for (int i=0;i<num && ret == 0;i++)
+		{
+			double Us[9], Ps[9];
+			polar_decomposition_3x3(&A[9 * i], false, Us, Ps);
+			if (memcmp(Us, &U[9 * i], sizeof(Us)) != 0 || memcmp(Ps, &P[9 * i], sizeof(Ps)) != 0)
+				ret = -1;
+		}
+
+		if (ret != 0)
+			CLEANUP("failed on grouped polar decomposition", -1);
+
+		num_tests++;
+	}
+
+	//the fused residual equals the sum of squared deviations from F applied to the ideal points
+	{
+		const deformationtable_t* tables[5] = {&deformation_sc, &deformation_fcc, &deformation_hcp, &deformation_ico, &deformation_bcc};
+		const double (*templates[5])[3] = {ptm_template_sc, ptm_template_fcc, ptm_template_hcp, ptm_template_ico, ptm_template_bcc};
+		srand(15);
+		for (int t=0;t<5;t++)
+		{
+			int n = tables[t]->num_points;
+			double points[PTM_MAX_POINTS][3];
+			int8_t mapping[PTM_MAX_POINTS];
+			for (int k=0;k<n;k++)
+			{
+				//11 is coprime to 7, 13 and 15, so this is a permutation
+				mapping[k] = (k * 11) % n;
+				for (int i=0;i<3;i++)
+					points[mapping[k]][i] = 1.05 * templates[t][k][i] + 0.05 * (rand() / (double)RAND_MAX - 0.5);
+			}
+
+			double F[9], res[3], expected[3] = {0, 0, 0};
+			calculate_deformation_gradient(tables[t], mapping, points, F, res);
+			for (int k=0;k<n;k++)
+				for (int i=0;i<3;i++)
+				{
+					double delta = F[3 * i + 0] * templates[t][k][0] + F[3 * i + 1] * templates[t][k][1] + F[3 * i + 2] * templates[t][k][2] - points[mapping[k]][i];
+					expected[i] += delta * delta;
+				}
+
+			for (int i=0;i<3;i++)
+				if (fabs(res[i] - expected[i]) > 1E-12 || expected[i] < 1E-6)
+					ret = -1;
+		}
+
+		if (ret != 0)
+			CLEANUP("failed on deformation gradient residual", -1);
+
+		num_tests++;
+	}
+
 cleanup:
 	printf("num tests completed: %d\n", num_tests);
 	ptm_uninitialize_local(local_handle);